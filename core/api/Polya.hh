@@ -1,5 +1,9 @@
 #pragma once
 
+#include "core/polya-enumeration/cycle-index/CycleIndexAlgebra.hh"
+#include "core/polya-enumeration/group/GroupCatalog.hh"
 #include "core/polya-enumeration/orbit-counting/OrbitCounting.hh"
+#include "core/polya-enumeration/polya/Async.hh"
+#include "core/polya-enumeration/polya/ColourCoefficients.hh"
 #include "core/polya-enumeration/polya/Polya.hh"
 #include "core/polya-enumeration/polynomial/Polynomial.hh"
\ No newline at end of file
@@ -0,0 +1,135 @@
+#include "core/bench/BenchGroups.hh"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace polya::bench
+{
+using Family = GroupCatalog::Family;
+
+namespace
+{
+struct FamilyDegrees
+{
+    Family theFamily;
+    std::vector<std::int64_t> theDegrees;
+};
+
+auto benchmarkedFamilies() -> const std::vector<FamilyDegrees>&
+{
+    static const auto theFamilies = std::vector{
+        FamilyDegrees{Family::Cyclic, {4, 16, 64, 256}},
+        FamilyDegrees{Family::Dihedral, {4, 16, 64, 256}},
+        FamilyDegrees{Family::Symmetric, {3, 4, 5, 6, 7}},
+    };
+    return theFamilies;
+}
+
+auto uniformFamilies() -> const std::vector<FamilyDegrees>&
+{
+    static const auto theFamilies = std::vector{
+        FamilyDegrees{Family::Cyclic, {4, 8, 16, 32}},
+        FamilyDegrees{Family::Dihedral, {4, 8, 16, 32}},
+        FamilyDegrees{Family::Symmetric, {3, 4, 5, 6, 7}},
+    };
+    return theFamilies;
+}
+
+auto colourFamilies() -> const std::vector<FamilyDegrees>&
+{
+    static const auto theFamilies = std::vector{
+        FamilyDegrees{Family::Cyclic, {4, 8, 12}},
+        FamilyDegrees{Family::Dihedral, {4, 8, 12}},
+        FamilyDegrees{Family::Symmetric, {3, 4, 5}},
+        FamilyDegrees{Family::Cube, {6}},
+    };
+    return theFamilies;
+}
+} // namespace
+
+auto family(const benchmark::State& aState) -> Family
+{
+    return static_cast<Family>(aState.range(0));
+}
+
+auto degree(const benchmark::State& aState) -> Permutation::Degree
+{
+    return Permutation::Degree{static_cast<std::size_t>(aState.range(1))};
+}
+
+auto colourCount(const benchmark::State& aState) -> orbits::ColourCount
+{
+    return orbits::ColourCount{static_cast<std::uint32_t>(aState.range(2))};
+}
+
+auto sharedGroup(benchmark::State& aState) -> GroupCatalog::GroupPtr
+{
+    auto myGroup = GroupCatalog::instance().get(family(aState), degree(aState));
+    aState.SetLabel(std::string{myGroup->name()});
+    return myGroup;
+}
+
+auto buildGroup(benchmark::State& aState) -> PermutationGroup
+{
+    switch (family(aState))
+    {
+    case Family::Cyclic:
+        return groups::cyclic(degree(aState));
+    case Family::Dihedral:
+        return groups::dihedral(degree(aState));
+    case Family::Symmetric:
+        return groups::symmetric(degree(aState));
+    case Family::Trivial:
+        return groups::trivial(degree(aState));
+    case Family::Tetrahedron:
+        return groups::tetrahedron();
+    case Family::Cube:
+        return groups::cube();
+    }
+    return groups::trivial(degree(aState));
+}
+
+auto groupArguments(benchmark::internal::Benchmark* aBenchmark) -> void
+{
+    aBenchmark->ArgNames({"family", "degree"});
+    for (const auto& [myFamily, myDegrees] : benchmarkedFamilies())
+    {
+        for (const auto myDegree : myDegrees)
+        {
+            aBenchmark->Args({static_cast<std::int64_t>(myFamily), myDegree});
+        }
+    }
+}
+
+namespace
+{
+auto addColourArguments(
+    benchmark::internal::Benchmark* aBenchmark, const std::vector<FamilyDegrees>& aFamilies,
+    const std::vector<std::int64_t>& aColourCounts
+) -> void
+{
+    aBenchmark->ArgNames({"family", "degree", "colours"});
+    for (const auto& [myFamily, myDegrees] : aFamilies)
+    {
+        for (const auto myDegree : myDegrees)
+        {
+            for (const auto myColours : aColourCounts)
+            {
+                aBenchmark->Args({static_cast<std::int64_t>(myFamily), myDegree, myColours});
+            }
+        }
+    }
+}
+} // namespace
+
+auto uniformArguments(benchmark::internal::Benchmark* aBenchmark) -> void
+{
+    addColourArguments(aBenchmark, uniformFamilies(), {2, 3});
+}
+
+auto colourArguments(benchmark::internal::Benchmark* aBenchmark) -> void
+{
+    addColourArguments(aBenchmark, colourFamilies(), {2, 3, 4});
+}
+} // namespace polya::bench
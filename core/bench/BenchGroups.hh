@@ -0,0 +1,28 @@
+#pragma once
+
+#include "core/polya-enumeration/group/GroupCatalog.hh"
+#include "core/polya-enumeration/group/PermutationGroup.hh"
+#include "core/polya-enumeration/orbit-counting/OrbitCounting.hh"
+
+#include <benchmark/benchmark.h>
+
+// Shared parameterization for the group benchmarks. Arguments are (family, degree[, colours]),
+// where family indexes GroupCatalog::Family; the group name is reported as the benchmark label.
+namespace polya::bench
+{
+[[nodiscard]] auto family(const benchmark::State& aState) -> GroupCatalog::Family;
+[[nodiscard]] auto degree(const benchmark::State& aState) -> Permutation::Degree;
+[[nodiscard]] auto colourCount(const benchmark::State& aState) -> orbits::ColourCount;
+
+// Cached group for benchmarks of the algorithms that consume a group
+[[nodiscard]] auto sharedGroup(benchmark::State& aState) -> GroupCatalog::GroupPtr;
+// Freshly generated group for benchmarks of group construction
+[[nodiscard]] auto buildGroup(benchmark::State& aState) -> PermutationGroup;
+
+// (family, degree) over cyclic, dihedral and symmetric groups of growing degree
+auto groupArguments(benchmark::internal::Benchmark* aBenchmark) -> void;
+// (family, degree, colours) with colours^degree small enough for exact 64-bit orbit counts
+auto uniformArguments(benchmark::internal::Benchmark* aBenchmark) -> void;
+// (family, degree, colours) over smaller groups, since the output grows with the colour count
+auto colourArguments(benchmark::internal::Benchmark* aBenchmark) -> void;
+} // namespace polya::bench
@@ -0,0 +1,121 @@
+#include "core/bench/OperationCounters.hh"
+#include "core/polya-enumeration/permutation/Permutation.hh"
+#include "core/polya-enumeration/polynomial/Polynomial.hh"
+#include "core/polya-enumeration/rational/Rational.hh"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+// Checked vs. unchecked access on the hot paths. Compare a default build against one with
+// --//core/util:checks=off to see the cost of the checks guarded by ensure_debug; Polynomial::set
+// checks in both.
+namespace polya::bench
+{
+namespace
+{
+using Degree = Permutation::Degree;
+using Element = Permutation::Element;
+
+auto BM_ChecksPermutationApply(benchmark::State& aState) -> void
+{
+    const auto myDegree = static_cast<std::uint32_t>(aState.range(0));
+    const auto myPermutation = permutations::rotation(Degree{myDegree});
+    const auto myCounters = OperationCounters{aState};
+    for (auto _ : aState)
+    {
+        for (auto myElement = Element{0}; myElement.get() < myDegree; ++myElement.get())
+        {
+            benchmark::DoNotOptimize(myPermutation(myElement));
+        }
+    }
+    aState.SetItemsProcessed(aState.iterations() * myDegree);
+}
+BENCHMARK(BM_ChecksPermutationApply)->RangeMultiplier(8)->Range(8, 4096);
+
+auto BM_ChecksPermutationApplyUnchecked(benchmark::State& aState) -> void
+{
+    const auto myDegree = static_cast<std::uint32_t>(aState.range(0));
+    const auto myPermutation = permutations::rotation(Degree{myDegree});
+    const auto myCounters = OperationCounters{aState};
+    for (auto _ : aState)
+    {
+        for (auto myElement = Element{0}; myElement.get() < myDegree; ++myElement.get())
+        {
+            benchmark::DoNotOptimize(myPermutation[myElement]);
+        }
+    }
+    aState.SetItemsProcessed(aState.iterations() * myDegree);
+}
+BENCHMARK(BM_ChecksPermutationApplyUnchecked)->RangeMultiplier(8)->Range(8, 4096);
+
+auto BM_ChecksPermutationCompose(benchmark::State& aState) -> void
+{
+    const auto myDegree = Degree{static_cast<std::size_t>(aState.range(0))};
+    const auto myRotation = permutations::rotation(myDegree);
+    auto myPermutation = permutations::reflection(myDegree);
+    const auto myCounters = OperationCounters{aState};
+    for (auto _ : aState)
+    {
+        myPermutation *= myRotation;
+        benchmark::DoNotOptimize(myPermutation);
+    }
+    aState.SetItemsProcessed(aState.iterations());
+}
+BENCHMARK(BM_ChecksPermutationCompose)->RangeMultiplier(8)->Range(8, 4096);
+
+auto makeTerms(std::size_t aVariableCount, std::size_t aTermCount) -> std::vector<Polynomial::Term>
+{
+    auto myTerms = std::vector<Polynomial::Term>{};
+    for (auto myIndex = 0uz; myIndex < aTermCount; ++myIndex)
+    {
+        auto myExponents =
+            std::vector<Polynomial::Exponent>(aVariableCount, Polynomial::Exponent{0});
+        myExponents[myIndex % aVariableCount] =
+            Polynomial::Exponent{static_cast<std::uint32_t>(myIndex / aVariableCount + 1)};
+        myTerms.emplace_back(std::move(myExponents));
+    }
+    return myTerms;
+}
+
+auto makeVariables(std::size_t aVariableCount) -> std::vector<Polynomial::VariableName>
+{
+    return std::vector<Polynomial::VariableName>(aVariableCount, Polynomial::VariableName{"x"});
+}
+
+auto BM_ChecksPolynomialSet(benchmark::State& aState) -> void
+{
+    const auto myTerms = makeTerms(4, static_cast<std::size_t>(aState.range(0)));
+    const auto myCounters = OperationCounters{aState};
+    for (auto _ : aState)
+    {
+        auto myPolynomial = Polynomial{makeVariables(4)};
+        for (const auto& myTerm : myTerms)
+        {
+            myPolynomial.set(myTerm, Rational{1});
+        }
+        benchmark::DoNotOptimize(myPolynomial);
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_ChecksPolynomialSet)->RangeMultiplier(8)->Range(8, 4096);
+
+auto BM_ChecksPolynomialSetUnchecked(benchmark::State& aState) -> void
+{
+    const auto myTerms = makeTerms(4, static_cast<std::size_t>(aState.range(0)));
+    const auto myCounters = OperationCounters{aState};
+    for (auto _ : aState)
+    {
+        auto myPolynomial = Polynomial{makeVariables(4)};
+        for (const auto& myTerm : myTerms)
+        {
+            myPolynomial.setUnchecked(myTerm, Rational{1});
+        }
+        benchmark::DoNotOptimize(myPolynomial);
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_ChecksPolynomialSetUnchecked)->RangeMultiplier(8)->Range(8, 4096);
+} // namespace
+} // namespace polya::bench
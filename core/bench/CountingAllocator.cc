@@ -0,0 +1,98 @@
+// Replaces the global operator new and delete with versions that count allocations and bytes, for
+// the bench-alloc binary only
+#include "core/bench/OperationCounters.hh"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+auto allocate(std::size_t aSize) -> void*
+{
+    polya::bench::recordAllocation(aSize);
+    if (auto* myPointer = std::malloc(aSize == 0 ? 1 : aSize))
+    {
+        return myPointer;
+    }
+    throw std::bad_alloc{};
+}
+
+auto allocate(std::size_t aSize, std::align_val_t anAlignment) -> void*
+{
+    polya::bench::recordAllocation(aSize);
+    const auto myAlignment = static_cast<std::size_t>(anAlignment);
+    // aligned_alloc requires the size to be a multiple of the alignment
+    const auto mySize = (aSize + myAlignment - 1) / myAlignment * myAlignment;
+    if (auto* myPointer = std::aligned_alloc(myAlignment, mySize == 0 ? myAlignment : mySize))
+    {
+        return myPointer;
+    }
+    throw std::bad_alloc{};
+}
+
+[[maybe_unused]] const auto theRegistration = []
+{
+    polya::bench::enableAllocationTracking();
+    return true;
+}();
+} // namespace
+
+auto operator new(std::size_t aSize) -> void*
+{
+    return allocate(aSize);
+}
+
+auto operator new[](std::size_t aSize) -> void*
+{
+    return allocate(aSize);
+}
+
+auto operator new(std::size_t aSize, std::align_val_t anAlignment) -> void*
+{
+    return allocate(aSize, anAlignment);
+}
+
+auto operator new[](std::size_t aSize, std::align_val_t anAlignment) -> void*
+{
+    return allocate(aSize, anAlignment);
+}
+
+auto operator delete(void* aPointer) noexcept -> void
+{
+    std::free(aPointer);
+}
+
+auto operator delete[](void* aPointer) noexcept -> void
+{
+    std::free(aPointer);
+}
+
+auto operator delete(void* aPointer, std::size_t) noexcept -> void
+{
+    std::free(aPointer);
+}
+
+auto operator delete[](void* aPointer, std::size_t) noexcept -> void
+{
+    std::free(aPointer);
+}
+
+auto operator delete(void* aPointer, std::align_val_t) noexcept -> void
+{
+    std::free(aPointer);
+}
+
+auto operator delete[](void* aPointer, std::align_val_t) noexcept -> void
+{
+    std::free(aPointer);
+}
+
+auto operator delete(void* aPointer, std::size_t, std::align_val_t) noexcept -> void
+{
+    std::free(aPointer);
+}
+
+auto operator delete[](void* aPointer, std::size_t, std::align_val_t) noexcept -> void
+{
+    std::free(aPointer);
+}
@@ -0,0 +1,214 @@
+#include "core/bench/HardwareCounters.hh"
+
+#include "core/util/ThreadPool.hh"
+
+#include <cstdlib>
+#include <latch>
+#include <mutex>
+#include <string_view>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+namespace polya::bench
+{
+namespace
+{
+#ifdef __linux__
+constexpr auto theEventConfigs = std::array<std::uint64_t, HardwareCounters::theEventCount>{
+    PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES};
+
+// Laid out by read_format below
+struct Reading
+{
+    std::uint64_t theValue;
+    std::uint64_t theTimeEnabled;
+    std::uint64_t theTimeRunning;
+};
+
+auto openEvent(std::uint64_t aConfig, pid_t aThread, int aLeader) -> int
+{
+    auto myAttributes = perf_event_attr{};
+    myAttributes.size = sizeof(perf_event_attr);
+    myAttributes.type = PERF_TYPE_HARDWARE;
+    myAttributes.config = aConfig;
+    myAttributes.disabled = aLeader == -1 ? 1 : 0; // Members follow the leader
+    myAttributes.exclude_kernel = 1;
+    myAttributes.exclude_hv = 1;
+    myAttributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &myAttributes, aThread, -1, aLeader, 0));
+}
+
+// One group per thread; the thread need not be the caller's
+auto openGroup(pid_t aThread) -> std::array<int, HardwareCounters::theEventCount>
+{
+    auto myDescriptors = std::array<int, HardwareCounters::theEventCount>{};
+    myDescriptors.fill(-1);
+    for (auto myIndex = 0uz; myIndex < HardwareCounters::theEventCount; ++myIndex)
+    {
+        myDescriptors[myIndex] =
+            openEvent(theEventConfigs[myIndex], aThread, myDescriptors.front());
+        if (myIndex == 0 and myDescriptors.front() == -1)
+        {
+            break; // Without cycles there is no group to join
+        }
+    }
+    return myDescriptors;
+}
+
+// The persistent workers already exist, so inheriting counters from the calling thread would
+// miss them. Each worker reports its thread id from a task that waits until all have reported,
+// so no worker can take two of them.
+auto workerThreads() -> std::vector<pid_t>
+{
+    auto& myPool = ThreadPool::shared();
+    auto myThreads = std::vector<pid_t>{};
+    auto myMutex = std::mutex{};
+    auto myReported = std::latch{static_cast<std::ptrdiff_t>(myPool.workerCount())};
+    auto myDone = std::latch{static_cast<std::ptrdiff_t>(myPool.workerCount())};
+    for (auto myIndex = 0uz; myIndex < myPool.workerCount(); ++myIndex)
+    {
+        myPool.submit(
+            [&]
+            {
+                {
+                    const auto myLock = std::scoped_lock{myMutex};
+                    myThreads.push_back(static_cast<pid_t>(syscall(SYS_gettid)));
+                }
+                myReported.arrive_and_wait();
+                myDone.count_down();
+            }
+        );
+    }
+    myDone.wait();
+    return myThreads;
+}
+#endif
+} // namespace
+
+HardwareCounters::HardwareCounters()
+{
+#ifdef __linux__
+    if (not requested())
+    {
+        return;
+    }
+    theThreads.push_back(openGroup(0));
+    if (not isOpen())
+    {
+        return;
+    }
+    for (const auto myThread : workerThreads())
+    {
+        theThreads.push_back(openGroup(myThread));
+    }
+#endif
+}
+
+HardwareCounters::~HardwareCounters()
+{
+#ifdef __linux__
+    for (const auto& myDescriptors : theThreads)
+    {
+        for (const auto myDescriptor : myDescriptors)
+        {
+            if (myDescriptor != -1)
+            {
+                close(myDescriptor);
+            }
+        }
+    }
+#endif
+}
+
+auto HardwareCounters::requested() -> bool
+{
+    const auto* myValue = std::getenv("POLYA_BENCH_PERF");
+    return myValue != nullptr and std::string_view{myValue} != ""
+           and std::string_view{myValue} != "0";
+}
+
+auto HardwareCounters::name(Event anEvent) -> const char*
+{
+    switch (anEvent)
+    {
+    case Event::Cycles:
+        return "cycles";
+    case Event::Instructions:
+        return "instructions";
+    case Event::CacheMisses:
+        return "cache-misses";
+    case Event::BranchMisses:
+        return "branch-misses";
+    }
+    return "unknown";
+}
+
+auto HardwareCounters::isOpen() const -> bool
+{
+    return not theThreads.empty() and theThreads.front().front() != -1;
+}
+
+auto HardwareCounters::start() -> void
+{
+#ifdef __linux__
+    for (const auto& myDescriptors : theThreads)
+    {
+        if (myDescriptors.front() != -1)
+        {
+            ioctl(myDescriptors.front(), PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(myDescriptors.front(), PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+    }
+#endif
+}
+
+auto HardwareCounters::stop() -> Readings
+{
+    auto myReadings = Readings{};
+#ifdef __linux__
+    if (not isOpen())
+    {
+        return myReadings;
+    }
+    for (const auto& myDescriptors : theThreads)
+    {
+        if (myDescriptors.front() != -1)
+        {
+            ioctl(myDescriptors.front(), PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        }
+    }
+    // Summed over the threads, from the events open on the calling thread
+    for (auto myIndex = 0uz; myIndex < theEventCount; ++myIndex)
+    {
+        if (theThreads.front()[myIndex] == -1)
+        {
+            continue;
+        }
+        auto myTotal = 0.0;
+        for (const auto& myDescriptors : theThreads)
+        {
+            auto myReading = Reading{};
+            if (myDescriptors[myIndex] == -1
+                or read(myDescriptors[myIndex], &myReading, sizeof(myReading))
+                       != sizeof(myReading)
+                or myReading.theTimeRunning == 0)
+            {
+                continue;
+            }
+            myTotal += static_cast<double>(myReading.theValue)
+                       * static_cast<double>(myReading.theTimeEnabled)
+                       / static_cast<double>(myReading.theTimeRunning);
+        }
+        myReadings[myIndex] = static_cast<std::uint64_t>(myTotal);
+    }
+#endif
+    return myReadings;
+}
+} // namespace polya::bench
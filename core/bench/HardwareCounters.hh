@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+// Hardware event counts for the calling thread and the workers of the shared thread pool, read
+// through Linux perf_event_open. Counting is opt-in with POLYA_BENCH_PERF=1; events that cannot be
+// opened (other platforms, containers, perf_event_paranoid too high) are left out. Events the
+// kernel multiplexes are scaled up by the fraction of the time they were counting.
+namespace polya::bench
+{
+class HardwareCounters
+{
+public:
+    enum class Event : std::size_t
+    {
+        Cycles,
+        Instructions,
+        CacheMisses,
+        BranchMisses,
+    };
+    static constexpr auto theEventCount = 4uz;
+    using Readings = std::array<std::optional<std::uint64_t>, theEventCount>; // By Event
+
+    // Opens the events if requested, without starting them. Waits for every shared pool worker to
+    // be idle, so it must not be called from inside the pool.
+    HardwareCounters();
+    ~HardwareCounters();
+
+    HardwareCounters(const HardwareCounters&) = delete;
+    auto operator=(const HardwareCounters&) -> HardwareCounters& = delete;
+
+    [[nodiscard]] static auto requested() -> bool;
+    [[nodiscard]] static auto name(Event anEvent) -> const char*;
+
+    [[nodiscard]] auto isOpen() const -> bool;
+    auto start() -> void;
+    [[nodiscard]] auto stop() -> Readings; // Empty readings for events that are not open
+
+private:
+    using Descriptors = std::array<int, theEventCount>; // -1 if not open; Cycles leads the group
+    std::vector<Descriptors> theThreads; // The calling thread first, then the pool workers
+};
+} // namespace polya::bench
@@ -0,0 +1,81 @@
+#include "core/bench/OperationCounters.hh"
+
+#include <atomic>
+#include <string>
+
+namespace polya::bench
+{
+namespace
+{
+auto theTracking = std::atomic<bool>{false};
+auto theAllocations = std::atomic<std::uint64_t>{0};
+auto theBytes = std::atomic<std::uint64_t>{0};
+} // namespace
+
+auto allocationTracking() -> bool
+{
+    return theTracking.load(std::memory_order_relaxed);
+}
+
+auto allocationCount() -> AllocationCount
+{
+    return AllocationCount{
+        theAllocations.load(std::memory_order_relaxed), theBytes.load(std::memory_order_relaxed)};
+}
+
+auto recordAllocation(std::uint64_t aBytes) -> void
+{
+    theAllocations.fetch_add(1, std::memory_order_relaxed);
+    theBytes.fetch_add(aBytes, std::memory_order_relaxed);
+}
+
+auto enableAllocationTracking() -> void
+{
+    theTracking.store(true, std::memory_order_relaxed);
+}
+
+OperationCounters::OperationCounters(benchmark::State& aState)
+    : theState{aState}, theStartAllocations{allocationCount()}
+{
+    theHardwareCounters.start(); // Last, so that construction is not counted
+}
+
+OperationCounters::~OperationCounters()
+{
+    const auto myReadings = theHardwareCounters.stop();
+    // Before any reporting, whose counter map insertions allocate
+    const auto myEnd = allocationCount();
+    // SetItemsProcessed stores the item total in this counter, converted to a rate at report time
+    const auto myItems = theState.counters.contains("items_per_second")
+                             ? theState.counters.at("items_per_second").value
+                             : 0.0;
+    for (auto myIndex = 0uz; myIndex < HardwareCounters::theEventCount; ++myIndex)
+    {
+        if (not myReadings[myIndex])
+        {
+            continue;
+        }
+        const auto myName =
+            std::string{HardwareCounters::name(static_cast<HardwareCounters::Event>(myIndex))};
+        const auto myValue = static_cast<double>(*myReadings[myIndex]);
+        theState.counters[myName + "/iter"] =
+            benchmark::Counter(myValue, benchmark::Counter::kAvgIterations);
+        if (myItems > 0)
+        {
+            theState.counters[myName + "/item"] = benchmark::Counter(myValue / myItems);
+        }
+    }
+
+    if (allocationTracking())
+    {
+        theState.counters["allocs/iter"] = benchmark::Counter(
+            static_cast<double>(myEnd.theAllocations - theStartAllocations.theAllocations),
+            benchmark::Counter::kAvgIterations
+        );
+        theState.counters["bytes/iter"] = benchmark::Counter(
+            static_cast<double>(myEnd.theBytes - theStartAllocations.theBytes),
+            benchmark::Counter::kAvgIterations, benchmark::Counter::OneK::kIs1024
+        );
+    }
+}
+} // namespace polya::bench
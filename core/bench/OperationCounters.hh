@@ -0,0 +1,42 @@
+#pragma once
+
+#include "core/bench/HardwareCounters.hh"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+// Counters reported per iteration alongside the time of each benchmark: heap allocations, and
+// hardware events when available. Hardware events are also reported per processed item when the
+// benchmark calls SetItemsProcessed. Construct one right before the benchmark loop so that setup is
+// not counted.
+namespace polya::bench
+{
+struct AllocationCount
+{
+    std::uint64_t theAllocations = 0;
+    std::uint64_t theBytes = 0;
+};
+
+// Totals since start up. Only the bench-alloc binary, which links the counting operator new,
+// tracks allocations; elsewhere these stay zero.
+[[nodiscard]] auto allocationTracking() -> bool;
+[[nodiscard]] auto allocationCount() -> AllocationCount;
+auto recordAllocation(std::uint64_t aBytes) -> void; // Called by the counting operator new
+auto enableAllocationTracking() -> void;
+
+class OperationCounters
+{
+public:
+    explicit OperationCounters(benchmark::State& aState);
+    ~OperationCounters(); // Adds the counters to the benchmark state
+
+    OperationCounters(const OperationCounters&) = delete;
+    auto operator=(const OperationCounters&) -> OperationCounters& = delete;
+
+private:
+    benchmark::State& theState;
+    AllocationCount theStartAllocations;
+    HardwareCounters theHardwareCounters;
+};
+} // namespace polya::bench
@@ -0,0 +1,23 @@
+#include "core/bench/BenchGroups.hh"
+#include "core/bench/OperationCounters.hh"
+#include "core/polya-enumeration/orbit-counting/OrbitCounting.hh"
+
+#include <benchmark/benchmark.h>
+
+namespace polya::bench
+{
+namespace
+{
+auto BM_CountOrbits(benchmark::State& aState) -> void
+{
+    const auto myGroup = sharedGroup(aState);
+    const auto myCounters = OperationCounters{aState};
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(orbits::countOrbits(*myGroup, colourCount(aState)));
+    }
+    aState.SetItemsProcessed(aState.iterations() * myGroup->order().get());
+}
+BENCHMARK(BM_CountOrbits)->Apply(uniformArguments);
+} // namespace
+} // namespace polya::bench
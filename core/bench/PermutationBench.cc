@@ -0,0 +1,66 @@
+#include "core/bench/OperationCounters.hh"
+#include "core/polya-enumeration/permutation/Permutation.hh"
+
+#include <benchmark/benchmark.h>
+
+namespace polya::bench
+{
+namespace
+{
+using Degree = Permutation::Degree;
+
+auto BM_PermutationCompose(benchmark::State& aState) -> void
+{
+    const auto myDegree = Degree{static_cast<std::size_t>(aState.range(0))};
+    const auto myRotation = permutations::rotation(myDegree);
+    const auto myReflection = permutations::reflection(myDegree);
+    const auto myCounters = OperationCounters{aState};
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(myRotation * myReflection);
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_PermutationCompose)->ArgName("degree")->RangeMultiplier(4)->Range(4, 4096);
+
+auto BM_PermutationInverse(benchmark::State& aState) -> void
+{
+    const auto myDegree = Degree{static_cast<std::size_t>(aState.range(0))};
+    const auto myPermutation =
+        permutations::rotation(myDegree) * permutations::reflection(myDegree);
+    const auto myCounters = OperationCounters{aState};
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(myPermutation.inverse());
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_PermutationInverse)->ArgName("degree")->RangeMultiplier(4)->Range(4, 4096);
+
+auto BM_PermutationAsCycles(benchmark::State& aState) -> void
+{
+    const auto myDegree = Degree{static_cast<std::size_t>(aState.range(0))};
+    const auto myPermutation = permutations::reflection(myDegree);
+    const auto myCounters = OperationCounters{aState};
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(myPermutation.asCycles());
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_PermutationAsCycles)->ArgName("degree")->RangeMultiplier(4)->Range(4, 4096);
+
+auto BM_PermutationCycleType(benchmark::State& aState) -> void
+{
+    const auto myDegree = Degree{static_cast<std::size_t>(aState.range(0))};
+    const auto myPermutation = permutations::reflection(myDegree);
+    const auto myCounters = OperationCounters{aState};
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(myPermutation.cycleType());
+    }
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+}
+BENCHMARK(BM_PermutationCycleType)->ArgName("degree")->RangeMultiplier(4)->Range(4, 4096);
+} // namespace
+} // namespace polya::bench
@@ -0,0 +1,24 @@
+#include "core/bench/BenchGroups.hh"
+#include "core/bench/OperationCounters.hh"
+#include "core/polya-enumeration/group/PermutationGroup.hh"
+
+#include <benchmark/benchmark.h>
+
+namespace polya::bench
+{
+namespace
+{
+// Group generation from generators (breadth first search over products)
+auto BM_PermutationGroupFromGenerators(benchmark::State& aState) -> void
+{
+    const auto myOrder = sharedGroup(aState)->order().get();
+    const auto myCounters = OperationCounters{aState};
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(buildGroup(aState));
+    }
+    aState.SetItemsProcessed(aState.iterations() * myOrder);
+}
+BENCHMARK(BM_PermutationGroupFromGenerators)->Apply(groupArguments);
+} // namespace
+} // namespace polya::bench
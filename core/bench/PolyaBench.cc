@@ -0,0 +1,51 @@
+#include "core/bench/BenchGroups.hh"
+#include "core/bench/OperationCounters.hh"
+#include "core/polya-enumeration/polya/Polya.hh"
+
+#include <benchmark/benchmark.h>
+
+namespace polya::bench
+{
+namespace
+{
+auto BM_CycleIndexPolynomial(benchmark::State& aState) -> void
+{
+    const auto myGroup = sharedGroup(aState);
+    const auto myCounters = OperationCounters{aState};
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(cycleIndexPolynomial(*myGroup));
+    }
+    aState.SetItemsProcessed(aState.iterations() * myGroup->order().get());
+}
+BENCHMARK(BM_CycleIndexPolynomial)->Apply(groupArguments);
+
+auto BM_EvaluateUniform(benchmark::State& aState) -> void
+{
+    const auto myCycleIndex = cycleIndexPolynomial(*sharedGroup(aState));
+    const auto myCounters = OperationCounters{aState};
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(evaluateUniform(myCycleIndex, colourCount(aState)));
+    }
+    aState.SetItemsProcessed(aState.iterations() * myCycleIndex.terms().size());
+}
+BENCHMARK(BM_EvaluateUniform)->Apply(uniformArguments);
+
+auto BM_EvaluateColours(benchmark::State& aState) -> void
+{
+    const auto myCycleIndex = cycleIndexPolynomial(*sharedGroup(aState));
+    const auto myColourCount = colourCount(aState);
+    auto myTermCount = 0uz;
+    const auto myCounters = OperationCounters{aState};
+    for (auto _ : aState)
+    {
+        const auto myResult = evaluateColours(myCycleIndex, myColourCount);
+        myTermCount = myResult.terms().size();
+        benchmark::DoNotOptimize(myResult);
+    }
+    aState.SetItemsProcessed(aState.iterations() * myTermCount);
+}
+BENCHMARK(BM_EvaluateColours)->Apply(colourArguments);
+} // namespace
+} // namespace polya::bench
@@ -0,0 +1,83 @@
+#include "core/bench/OperationCounters.hh"
+#include "core/polya-enumeration/polynomial/Polynomial.hh"
+#include "core/polya-enumeration/rational/Rational.hh"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+namespace polya::bench
+{
+namespace
+{
+// (1 + x_1 + ... + x_v)^d, which has C(v + d, d) terms
+auto powerOfLinearForm(std::size_t aVariableCount, std::size_t aPower) -> Polynomial
+{
+    auto myVariables = std::vector<Polynomial::VariableName>{};
+    for (auto myIndex = 1uz; myIndex <= aVariableCount; ++myIndex)
+    {
+        myVariables.emplace_back("x_" + std::to_string(myIndex));
+    }
+    auto myLinearForm = Polynomial{myVariables};
+    auto myExponents = std::vector<Polynomial::Exponent>(aVariableCount, Polynomial::Exponent{0});
+    myLinearForm.set(Polynomial::Term{myExponents}, Rational{1});
+    for (auto& myExponent : myExponents)
+    {
+        myExponent = Polynomial::Exponent{1};
+        myLinearForm.set(Polynomial::Term{myExponents}, Rational{1});
+        myExponent = Polynomial::Exponent{0};
+    }
+
+    auto myResult = Polynomial{myVariables};
+    myResult.set(Polynomial::Term{myExponents}, Rational{1});
+    for (auto myIndex = 0uz; myIndex < aPower; ++myIndex)
+    {
+        myResult *= myLinearForm;
+    }
+    return myResult;
+}
+
+auto polynomialArguments(benchmark::internal::Benchmark* aBenchmark) -> void
+{
+    aBenchmark->ArgNames({"variables", "power"});
+    for (const auto myVariables : {2, 3, 4})
+    {
+        for (const auto myPower : {2, 4, 8})
+        {
+            aBenchmark->Args({myVariables, myPower});
+        }
+    }
+}
+
+auto BM_PolynomialAdd(benchmark::State& aState) -> void
+{
+    const auto myVariables = static_cast<std::size_t>(aState.range(0));
+    const auto myPower = static_cast<std::size_t>(aState.range(1));
+    const auto myLhs = powerOfLinearForm(myVariables, myPower);
+    const auto myRhs = powerOfLinearForm(myVariables, myPower + 1);
+    const auto myCounters = OperationCounters{aState};
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(myLhs + myRhs);
+    }
+    aState.SetItemsProcessed(aState.iterations() * myRhs.terms().size());
+}
+BENCHMARK(BM_PolynomialAdd)->Apply(polynomialArguments);
+
+auto BM_PolynomialMultiply(benchmark::State& aState) -> void
+{
+    const auto myVariables = static_cast<std::size_t>(aState.range(0));
+    const auto myPower = static_cast<std::size_t>(aState.range(1));
+    const auto myLhs = powerOfLinearForm(myVariables, myPower);
+    const auto myRhs = powerOfLinearForm(myVariables, 2);
+    const auto myCounters = OperationCounters{aState};
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(myLhs * myRhs);
+    }
+    aState.SetItemsProcessed(aState.iterations() * myLhs.terms().size() * myRhs.terms().size());
+}
+BENCHMARK(BM_PolynomialMultiply)->Apply(polynomialArguments);
+} // namespace
+} // namespace polya::bench
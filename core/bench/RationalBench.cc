@@ -0,0 +1,77 @@
+#include "core/bench/OperationCounters.hh"
+#include "core/polya-enumeration/rational/Rational.hh"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+
+namespace polya::bench
+{
+namespace
+{
+auto operands() -> const std::array<Rational, 8>&
+{
+    static const auto theOperands = std::array{
+        Rational{Rational::Numerator{1}, Rational::Denominator{24}},
+        Rational{Rational::Numerator{7}, Rational::Denominator{12}},
+        Rational{Rational::Numerator{-5}, Rational::Denominator{6}},
+        Rational{Rational::Numerator{3}, Rational::Denominator{40320}},
+        Rational{Rational::Numerator{120}, Rational::Denominator{7}},
+        Rational{Rational::Numerator{1}, Rational::Denominator{1}},
+        Rational{Rational::Numerator{999}, Rational::Denominator{1000}},
+        Rational{Rational::Numerator{-1}, Rational::Denominator{3}},
+    };
+    return theOperands;
+}
+
+template <typename Operation>
+auto benchmarkOperation(benchmark::State& aState, Operation anOperation) -> void
+{
+    const auto& myOperands = operands();
+    const auto myCounters = OperationCounters{aState};
+    for (auto _ : aState)
+    {
+        for (const auto& myLhs : myOperands)
+        {
+            for (const auto& myRhs : myOperands)
+            {
+                benchmark::DoNotOptimize(anOperation(myLhs, myRhs));
+            }
+        }
+    }
+    aState.SetItemsProcessed(aState.iterations() * myOperands.size() * myOperands.size());
+}
+
+auto BM_RationalAdd(benchmark::State& aState) -> void
+{
+    benchmarkOperation(
+        aState, [](const Rational& aLhs, const Rational& aRhs) { return aLhs + aRhs; }
+    );
+}
+BENCHMARK(BM_RationalAdd);
+
+auto BM_RationalMultiply(benchmark::State& aState) -> void
+{
+    benchmarkOperation(
+        aState, [](const Rational& aLhs, const Rational& aRhs) { return aLhs * aRhs; }
+    );
+}
+BENCHMARK(BM_RationalMultiply);
+
+auto BM_RationalDivide(benchmark::State& aState) -> void
+{
+    benchmarkOperation(
+        aState, [](const Rational& aLhs, const Rational& aRhs) { return aLhs / aRhs; }
+    );
+}
+BENCHMARK(BM_RationalDivide);
+
+auto BM_RationalCompare(benchmark::State& aState) -> void
+{
+    benchmarkOperation(
+        aState, [](const Rational& aLhs, const Rational& aRhs) { return aLhs < aRhs; }
+    );
+}
+BENCHMARK(BM_RationalCompare);
+} // namespace
+} // namespace polya::bench
@@ -0,0 +1,261 @@
+#include "core/bench/scaling/Scaling.hh"
+
+#include "core/polya-enumeration/group/GroupCatalog.hh"
+#include "core/polya-enumeration/orbit-counting/OrbitCounting.hh"
+#include "core/polya-enumeration/polya/Polya.hh"
+#include "core/util/Exception.hh"
+#include "core/util/ThreadPool.hh"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <limits>
+#include <regex>
+#include <sstream>
+
+namespace polya::bench::scaling
+{
+using Degree = Permutation::Degree;
+using Family = GroupCatalog::Family;
+
+namespace
+{
+// Each point is the best of several repeats, each running long enough to dwarf timer overhead
+constexpr auto theRepeats = 5;
+constexpr auto theMinimumDuration = std::chrono::milliseconds{10};
+
+struct Case
+{
+    double theParameter;
+    std::function<void()> theCall;
+};
+
+auto secondsPerCall(const std::function<void()>& aCall) -> double
+{
+    using Clock = std::chrono::steady_clock;
+    aCall(); // Warm up caches and lazily built state
+    auto myBest = std::numeric_limits<double>::infinity();
+    for (auto myRepeat = 0; myRepeat < theRepeats; ++myRepeat)
+    {
+        for (auto myIterations = 1uz;; myIterations *= 2)
+        {
+            const auto myStart = Clock::now();
+            for (auto myIteration = 0uz; myIteration < myIterations; ++myIteration)
+            {
+                aCall();
+            }
+            const auto myElapsed = Clock::now() - myStart;
+            if (myElapsed >= theMinimumDuration)
+            {
+                myBest = std::min(
+                    myBest, std::chrono::duration<double>{myElapsed}.count()
+                                / static_cast<double>(myIterations)
+                );
+                break;
+            }
+        }
+    }
+    return myBest;
+}
+
+// Times aCall on the only worker of the shared pool. Parallel loops started there find no idle
+// worker to hand chunks to, so the whole call runs on one thread whatever the core count.
+auto singleThreadedSecondsPerCall(const std::function<void()>& aCall) -> double
+{
+    auto& myPool = ThreadPool::shared();
+    ensure(
+        myPool.workerCount() == 1,
+        "Scaling sweeps need a single worker, but the shared pool already has {}",
+        myPool.workerCount()
+    );
+    auto myResult = std::promise<double>{};
+    auto myFuture = myResult.get_future();
+    myPool.submit(
+        [&aCall, &myResult]
+        {
+            try
+            {
+                myResult.set_value(secondsPerCall(aCall));
+            }
+            catch (...)
+            {
+                myResult.set_exception(std::current_exception());
+            }
+        }
+    );
+    return myFuture.get();
+}
+
+auto measure(std::string aName, const std::vector<Case>& aCases) -> Sweep
+{
+    auto myPoints = std::vector<Point>{};
+    for (const auto& [myParameter, myCall] : aCases)
+    {
+        myPoints.push_back(Point{myParameter, singleThreadedSecondsPerCall(myCall)});
+    }
+    const auto myExponent = fitExponent(myPoints);
+    return Sweep{std::move(aName), std::move(myPoints), myExponent};
+}
+
+auto countOrbitsCase(Family aFamily, std::size_t aDegree, std::uint32_t aColours) -> Case
+{
+    auto myGroup = GroupCatalog::instance().get(aFamily, Degree{aDegree});
+    const auto myOrder = static_cast<double>(myGroup->order().get());
+    return Case{
+        myOrder,
+        [myGroup, aColours]
+        {
+            benchmark::DoNotOptimize(
+                orbits::countOrbits(*myGroup, orbits::ColourCount{aColours})
+            );
+        }};
+}
+
+auto cycleIndexCase(Family aFamily, std::size_t aDegree, double aParameter) -> Case
+{
+    auto myGroup = GroupCatalog::instance().get(aFamily, Degree{aDegree});
+    return Case{
+        aParameter, [myGroup] { benchmark::DoNotOptimize(cycleIndexPolynomial(*myGroup)); }};
+}
+
+auto evaluateColoursCase(
+    Family aFamily, std::size_t aDegree, std::uint32_t aColours, double aParameter
+) -> Case
+{
+    auto myCycleIndex =
+        cycleIndexPolynomial(*GroupCatalog::instance().get(aFamily, Degree{aDegree}));
+    return Case{
+        aParameter,
+        [myCycleIndex = std::move(myCycleIndex), aColours]
+        {
+            benchmark::DoNotOptimize(
+                evaluateColours(myCycleIndex, orbits::ColourCount{aColours})
+            );
+        }};
+}
+
+auto orderOf(Family aFamily, std::size_t aDegree) -> double
+{
+    const auto myGroup = GroupCatalog::instance().get(aFamily, Degree{aDegree});
+    return static_cast<double>(myGroup->order().get());
+}
+} // namespace
+
+auto runSweeps() -> std::vector<Sweep>
+{
+    auto mySweeps = std::vector<Sweep>{};
+
+    auto myCases = std::vector<Case>{};
+    for (const auto myDegree : {4uz, 5uz, 6uz, 7uz, 8uz})
+    {
+        myCases.push_back(countOrbitsCase(Family::Symmetric, myDegree, 3));
+    }
+    mySweeps.push_back(measure("countOrbits/symmetric/order", myCases));
+
+    myCases.clear();
+    for (const auto myDegree : {4uz, 5uz, 6uz, 7uz, 8uz})
+    {
+        myCases.push_back(
+            cycleIndexCase(Family::Symmetric, myDegree, orderOf(Family::Symmetric, myDegree))
+        );
+    }
+    mySweeps.push_back(measure("cycleIndexPolynomial/symmetric/order", myCases));
+
+    myCases.clear();
+    for (const auto myDegree : {64uz, 128uz, 256uz, 512uz, 1024uz})
+    {
+        myCases.push_back(cycleIndexCase(Family::Cyclic, myDegree, static_cast<double>(myDegree)));
+    }
+    mySweeps.push_back(measure("cycleIndexPolynomial/cyclic/degree", myCases));
+
+    myCases.clear();
+    for (const auto myDegree : {4uz, 6uz, 8uz, 10uz, 12uz})
+    {
+        myCases.push_back(
+            evaluateColoursCase(Family::Cyclic, myDegree, 3, static_cast<double>(myDegree))
+        );
+    }
+    mySweeps.push_back(measure("evaluateColours/cyclic/degree", myCases));
+
+    myCases.clear();
+    for (const auto myColours : {2u, 3u, 4u, 5u, 6u})
+    {
+        myCases.push_back(
+            evaluateColoursCase(Family::Cyclic, 6, myColours, static_cast<double>(myColours))
+        );
+    }
+    mySweeps.push_back(measure("evaluateColours/cyclic/colours", myCases));
+
+    return mySweeps;
+}
+
+auto fitExponent(const std::vector<Point>& aPoints) -> double
+{
+    ensure(aPoints.size() >= 2, "Fitting an exponent needs at least two points");
+    auto mySumX = 0.0;
+    auto mySumY = 0.0;
+    auto mySumXX = 0.0;
+    auto mySumXY = 0.0;
+    for (const auto& [myParameter, mySeconds] : aPoints)
+    {
+        const auto myX = std::log(myParameter);
+        const auto myY = std::log(mySeconds);
+        mySumX += myX;
+        mySumY += myY;
+        mySumXX += myX * myX;
+        mySumXY += myX * myY;
+    }
+    const auto myCount = static_cast<double>(aPoints.size());
+    return (myCount * mySumXY - mySumX * mySumY) / (myCount * mySumXX - mySumX * mySumX);
+}
+
+auto toJson(const std::vector<Sweep>& aSweeps) -> std::string
+{
+    auto myStream = std::ostringstream{};
+    myStream.precision(6);
+    myStream << "{\n  \"sweeps\": [\n";
+    for (auto myIndex = 0uz; myIndex < aSweeps.size(); ++myIndex)
+    {
+        const auto& mySweep = aSweeps[myIndex];
+        myStream << "    {\"name\": \"" << mySweep.theName
+                 << "\", \"exponent\": " << mySweep.theExponent << ", \"points\": [";
+        for (auto myPoint = 0uz; myPoint < mySweep.thePoints.size(); ++myPoint)
+        {
+            const auto& [myParameter, mySeconds] = mySweep.thePoints[myPoint];
+            myStream << (myPoint == 0 ? "" : ", ") << '[' << myParameter << ", " << mySeconds
+                     << ']';
+        }
+        myStream << "]}" << (myIndex + 1 == aSweeps.size() ? "" : ",") << '\n';
+    }
+    myStream << "  ]\n}\n";
+    return myStream.str();
+}
+
+auto parseBaselines(std::istream& aStream) -> Baselines
+{
+    // toJson writes one sweep per line
+    static const auto theSweep =
+        std::regex{R"re("name": "([^"]+)", "exponent": ([-+0-9.eE]+))re"};
+    auto myBaselines = Baselines{};
+    for (auto myLine = std::string{}; std::getline(aStream, myLine);)
+    {
+        if (auto myMatch = std::smatch{}; std::regex_search(myLine, myMatch, theSweep))
+        {
+            myBaselines.insert_or_assign(myMatch[1].str(), std::stod(myMatch[2].str()));
+        }
+    }
+    return myBaselines;
+}
+
+auto readBaselines(const std::string& aPath) -> Baselines
+{
+    auto myFile = std::ifstream{aPath};
+    ensure(myFile.good(), "Could not open baselines {}", aPath);
+    return parseBaselines(myFile);
+}
+} // namespace polya::bench::scaling
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+// Scaling sweeps over the main entry points. Each sweep times one entry point over a growing
+// parameter (group order, degree or colour count) and fits time ~ parameter^exponent by least
+// squares on log-log axes. Exponents, unlike absolute times, are comparable across machines, so
+// they are what the stored baselines are checked against.
+namespace polya::bench::scaling
+{
+struct Point
+{
+    double theParameter;
+    double theSeconds; // Best mean time per call
+};
+
+struct Sweep
+{
+    std::string theName; // entry point/group family/parameter
+    std::vector<Point> thePoints;
+    double theExponent;
+};
+
+using Baselines = std::map<std::string, double>; // Exponent by sweep name
+
+// Times every call on the only worker of the shared pool, so that the exponents do not depend on
+// the core count. Throws unless the process runs with POLYA_THREADS=1.
+[[nodiscard]] auto runSweeps() -> std::vector<Sweep>;
+
+[[nodiscard]] auto fitExponent(const std::vector<Point>& aPoints) -> double;
+
+[[nodiscard]] auto toJson(const std::vector<Sweep>& aSweeps) -> std::string;
+[[nodiscard]] auto parseBaselines(std::istream& aStream) -> Baselines; // Reads toJson output
+[[nodiscard]] auto readBaselines(const std::string& aPath) -> Baselines;
+} // namespace polya::bench::scaling
@@ -0,0 +1,54 @@
+#include "core/bench/scaling/Scaling.hh"
+#include "core/util/Exception.hh"
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string_view>
+
+using namespace polya::bench::scaling;
+
+// Runs the sweeps and prints the fitted exponents; with --write <path>, also stores them as the
+// new baselines. Under bazel run, relative paths are resolved against the workspace.
+auto main(int argc, char** argv) -> int
+{
+    auto myOutputPath = std::filesystem::path{};
+    if (argc == 3 and std::string_view{argv[1]} == "--write")
+    {
+        myOutputPath = argv[2];
+        if (const auto* myWorkspace = std::getenv("BUILD_WORKSPACE_DIRECTORY");
+            myWorkspace != nullptr and myOutputPath.is_relative())
+        {
+            myOutputPath = std::filesystem::path{myWorkspace} / myOutputPath;
+        }
+    }
+    else if (argc != 1)
+    {
+        std::cerr << "Usage: " << argv[0] << " [--write <baselines.json>]\n";
+        return 1;
+    }
+
+    // The shared pool reads its size once, so it cannot be narrowed from here
+    if (const auto* myThreads = std::getenv("POLYA_THREADS");
+        myThreads == nullptr or std::string_view{myThreads} != "1")
+    {
+        std::cerr << "Scaling sweeps time one thread: run with POLYA_THREADS=1\n";
+        return 1;
+    }
+
+    const auto mySweeps = runSweeps();
+    for (const auto& mySweep : mySweeps)
+    {
+        std::cout << mySweep.theName << ": exponent " << mySweep.theExponent << '\n';
+    }
+
+    if (not myOutputPath.empty())
+    {
+        auto myFile = std::ofstream{myOutputPath};
+        myFile << toJson(mySweeps);
+        polya::ensure(myFile.good(), "Could not write baselines {}", myOutputPath.string());
+        std::cout << "Wrote " << myOutputPath.string() << '\n';
+    }
+    return 0;
+}
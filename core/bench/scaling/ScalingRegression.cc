@@ -0,0 +1,46 @@
+#include "core/bench/scaling/Scaling.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <string>
+
+namespace polya::test
+{
+using namespace ::testing;
+using namespace bench::scaling;
+
+namespace
+{
+// How far a fitted exponent may exceed its baseline, e.g. --test_env=POLYA_SCALING_THRESHOLD=0.5
+auto threshold() -> double
+{
+    const auto* myValue = std::getenv("POLYA_SCALING_THRESHOLD");
+    return myValue != nullptr ? std::stod(myValue) : 0.35;
+}
+} // namespace
+
+class ScalingRegression : public ::testing::Test
+{
+};
+
+TEST_F(ScalingRegression, ExponentsWithinThresholdOfBaselines)
+{
+    const auto myBaselines = readBaselines("core/bench/scaling/baselines.json");
+    const auto mySweeps = runSweeps();
+    EXPECT_THAT(mySweeps.size(), Eq(myBaselines.size()));
+    for (const auto& mySweep : mySweeps)
+    {
+        const auto myBaseline = myBaselines.find(mySweep.theName);
+        if (myBaseline == myBaselines.end())
+        {
+            ADD_FAILURE() << "No baseline for sweep " << mySweep.theName;
+            continue;
+        }
+        EXPECT_THAT(mySweep.theExponent, Le(myBaseline->second + threshold()))
+            << mySweep.theName << " scales worse than its baseline exponent "
+            << myBaseline->second;
+    }
+}
+} // namespace polya::test
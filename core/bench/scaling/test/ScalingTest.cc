@@ -0,0 +1,54 @@
+#include "core/bench/scaling/Scaling.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <sstream>
+
+namespace polya::test
+{
+using namespace ::testing;
+using namespace bench::scaling;
+
+class ScalingTest : public ::testing::Test
+{
+};
+
+TEST_F(ScalingTest, FitsExactPowerLaw)
+{
+    auto myPoints = std::vector<Point>{};
+    for (const auto myParameter : {2.0, 4.0, 8.0, 16.0})
+    {
+        myPoints.push_back(Point{myParameter, 3e-6 * std::pow(myParameter, 2.5)});
+    }
+    EXPECT_THAT(fitExponent(myPoints), DoubleNear(2.5, 1e-9));
+}
+
+TEST_F(ScalingTest, FitsConstantAsZero)
+{
+    const auto myPoints = std::vector{Point{1.0, 5e-3}, Point{10.0, 5e-3}, Point{100.0, 5e-3}};
+    EXPECT_THAT(fitExponent(myPoints), DoubleNear(0.0, 1e-9));
+}
+
+TEST_F(ScalingTest, TooFewPointsThrows)
+{
+    EXPECT_THROW(static_cast<void>(fitExponent({Point{1.0, 1.0}})), std::runtime_error);
+}
+
+TEST_F(ScalingTest, JsonRoundTripsExponents)
+{
+    const auto mySweeps = std::vector{
+        Sweep{"countOrbits/symmetric/order", {Point{24, 1e-6}, Point{120, 5e-6}}, 1.0},
+        Sweep{"evaluateColours/cyclic/colours", {Point{2, 1e-5}, Point{3, 9e-5}}, 5.42},
+    };
+    auto myStream = std::istringstream{toJson(mySweeps)};
+    EXPECT_THAT(
+        parseBaselines(myStream),
+        ElementsAre(
+            Pair("countOrbits/symmetric/order", DoubleEq(1.0)),
+            Pair("evaluateColours/cyclic/colours", DoubleEq(5.42))
+        )
+    );
+}
+} // namespace polya::test
@@ -0,0 +1,69 @@
+#include "core/driver/LatencyHistogram.hh"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <format>
+
+namespace polya::driver
+{
+auto LatencyHistogram::record(std::chrono::nanoseconds aLatency) -> void
+{
+    const auto myMicroseconds = static_cast<std::uint64_t>(std::max<std::int64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(aLatency).count(), 0
+    ));
+    const auto myBucket = std::min<std::size_t>(std::bit_width(myMicroseconds), theBucketCount - 1);
+    theBuckets[myBucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+auto LatencyHistogram::count() const -> std::uint64_t
+{
+    auto myCount = std::uint64_t{0};
+    for (const auto& myBucket : theBuckets)
+    {
+        myCount += myBucket.load(std::memory_order_relaxed);
+    }
+    return myCount;
+}
+
+auto LatencyHistogram::bucket(std::size_t anIndex) const -> std::uint64_t
+{
+    return theBuckets[anIndex].load(std::memory_order_relaxed);
+}
+
+auto LatencyHistogram::quantile(double aQuantile) const -> std::chrono::microseconds
+{
+    const auto myCount = count();
+    const auto myRank =
+        static_cast<std::uint64_t>(std::ceil(aQuantile * static_cast<double>(myCount)));
+    auto mySeen = std::uint64_t{0};
+    for (auto myIndex = 0uz; myIndex < theBucketCount; ++myIndex)
+    {
+        mySeen += bucket(myIndex);
+        if (mySeen >= myRank and mySeen > 0)
+        {
+            return std::chrono::microseconds{1LL << myIndex};
+        }
+    }
+    return std::chrono::microseconds{0};
+}
+
+auto LatencyHistogram::toJson() const -> std::string
+{
+    auto myJson = std::format(
+        "{{\"count\":{},\"p50_us\":{},\"p90_us\":{},\"p99_us\":{},\"buckets_us\":{{", count(),
+        quantile(0.5).count(), quantile(0.9).count(), quantile(0.99).count()
+    );
+    auto myFirst = true;
+    for (auto myIndex = 0uz; myIndex < theBucketCount; ++myIndex)
+    {
+        if (const auto myCount = bucket(myIndex); myCount > 0)
+        {
+            // Keyed by the bucket's exclusive upper bound
+            myJson += std::format("{}\"{}\":{}", myFirst ? "" : ",", 1ULL << myIndex, myCount);
+            myFirst = false;
+        }
+    }
+    return myJson + "}}";
+}
+} // namespace polya::driver
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace polya::driver
+{
+// Request latencies in power of two microsecond buckets: bucket b counts latencies in
+// [2^(b-1), 2^b) us, with bucket 0 for latencies under 1 us. Recording is lock free.
+class LatencyHistogram
+{
+public:
+    static constexpr auto theBucketCount = 32uz;
+
+    auto record(std::chrono::nanoseconds aLatency) -> void;
+
+    [[nodiscard]] auto count() const -> std::uint64_t;
+    [[nodiscard]] auto bucket(std::size_t anIndex) const -> std::uint64_t;
+    // Upper bound of the bucket holding the given quantile, e.g. 0.99
+    [[nodiscard]] auto quantile(double aQuantile) const -> std::chrono::microseconds;
+
+    [[nodiscard]] auto toJson() const -> std::string; // One line
+
+private:
+    std::array<std::atomic<std::uint64_t>, theBucketCount> theBuckets{};
+};
+} // namespace polya::driver
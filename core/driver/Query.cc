@@ -0,0 +1,208 @@
+#include "core/driver/Query.hh"
+
+#include "core/util/Exception.hh"
+
+#include <charconv>
+#include <map>
+#include <set>
+#include <utility>
+
+namespace polya::driver
+{
+using Family = GroupCatalog::Family;
+using Degree = Permutation::Degree;
+using Cycle = Permutation::Cycle;
+
+namespace
+{
+auto parseFamily(std::string_view aName) -> Family
+{
+    static const auto theFamilies = std::map<std::string_view, Family>{
+        {"cyclic", Family::Cyclic},
+        {"dihedral", Family::Dihedral},
+        {"symmetric", Family::Symmetric},
+        {"trivial", Family::Trivial},
+        {"tetrahedron", Family::Tetrahedron},
+        {"cube", Family::Cube},
+    };
+    const auto myFamily = theFamilies.find(aName);
+    ensure(myFamily != theFamilies.end(), "Unknown group family '{}'", aName);
+    return myFamily->second;
+}
+
+template <typename T>
+auto parseNumber(std::string_view aText, std::string_view aField) -> T
+{
+    auto myValue = T{};
+    const auto* myLast = aText.data() + aText.size();
+    const auto [myEnd, myError] = std::from_chars(aText.data(), myLast, myValue);
+    ensure(
+        myError == std::errc{} and myEnd == myLast,
+        "Expected a non-negative integer for {}, but received '{}'", aField, aText
+    );
+    return myValue;
+}
+
+// Splits on a separator outside parentheses
+auto split(std::string_view aText, auto isSeparator) -> std::vector<std::string_view>
+{
+    auto myParts = std::vector<std::string_view>{};
+    auto myDepth = 0;
+    auto myStart = 0uz;
+    for (auto myIndex = 0uz; myIndex <= aText.size(); ++myIndex)
+    {
+        if (myIndex < aText.size())
+        {
+            myDepth += aText[myIndex] == '(' ? 1 : aText[myIndex] == ')' ? -1 : 0;
+            ensure(myDepth >= 0 and myDepth <= 1, "Unbalanced parentheses in '{}'", aText);
+        }
+        if (myIndex == aText.size() or (myDepth == 0 and isSeparator(aText[myIndex])))
+        {
+            if (myIndex > myStart)
+            {
+                myParts.push_back(aText.substr(myStart, myIndex - myStart));
+            }
+            myStart = myIndex + 1;
+        }
+    }
+    ensure(myDepth == 0, "Unbalanced parentheses in '{}'", aText);
+    return myParts;
+}
+
+// A product of disjoint cycles, e.g. (0 2)(1 3); the identity is written (). An element repeated
+// within or across cycles would not describe a bijection, so it is rejected.
+auto parseGenerator(std::string_view aText) -> std::vector<Cycle>
+{
+    const auto myGenerator = aText;
+    auto myCycles = std::vector<Cycle>{};
+    auto mySeen = std::set<std::uint32_t>{};
+    while (not aText.empty())
+    {
+        const auto myClose = aText.find(')');
+        ensure(
+            aText.front() == '(' and myClose != std::string_view::npos,
+            "Expected a cycle in parentheses, but received '{}'", aText
+        );
+        auto myElements = std::vector<Permutation::Element>{};
+        for (const auto myElement :
+             split(aText.substr(1, myClose - 1), [](char aCharacter) { return aCharacter == ' '; }))
+        {
+            const auto myValue = parseNumber<std::uint32_t>(myElement, "a cycle element");
+            ensure(
+                mySeen.insert(myValue).second,
+                "Element {} appears more than once in generator '{}'", myValue, myGenerator
+            );
+            myElements.emplace_back(myValue);
+        }
+        myCycles.emplace_back(std::move(myElements));
+        aText.remove_prefix(myClose + 1);
+    }
+    return myCycles;
+}
+} // namespace
+
+auto Query::groupKey() const -> std::string
+{
+    if (const auto* myFamily = std::get_if<FamilySpec>(&theGroup))
+    {
+        return std::to_string(static_cast<std::size_t>(myFamily->theFamily)) + ':'
+               + std::to_string(myFamily->theDegree.get());
+    }
+    const auto& myGenerators = std::get<GeneratorSpec>(theGroup);
+    auto myKey = "generators:" + std::to_string(myGenerators.theDegree.get());
+    for (const auto& myGenerator : myGenerators.theGenerators)
+    {
+        myKey += ':' + Permutation{myGenerators.theDegree, myGenerator}.toString();
+    }
+    return myKey;
+}
+
+auto parseQuery(std::string_view aLine) -> Query
+{
+    auto myFields = std::map<std::string_view, std::string_view>{};
+    for (const auto myField :
+         split(aLine, [](char aCharacter) { return aCharacter == ' ' or aCharacter == '\t'; }))
+    {
+        const auto myEquals = myField.find('=');
+        ensure(
+            myEquals != std::string_view::npos, "Expected key=value, but received '{}'", myField
+        );
+        const auto [myPosition, myInserted] =
+            myFields.emplace(myField.substr(0, myEquals), myField.substr(myEquals + 1));
+        ensure(myInserted, "Repeated field '{}'", myPosition->first);
+    }
+
+    const auto take = [&myFields](std::string_view aKey) -> std::optional<std::string_view>
+    {
+        const auto myField = myFields.find(aKey);
+        if (myField == myFields.end())
+        {
+            return std::nullopt;
+        }
+        const auto myValue = myField->second;
+        myFields.erase(myField);
+        return myValue;
+    };
+
+    const auto myId = take("id");
+    const auto myFamily = take("group");
+    const auto myGenerators = take("generators");
+    const auto myDegree = take("degree");
+    const auto myColours = take("colours");
+    const auto myMultiplicities = take("multiplicities");
+    ensure(myFields.empty(), "Unknown field '{}'", myFields.empty() ? "" : myFields.begin()->first);
+    ensure(myColours.has_value(), "Missing field 'colours'");
+    ensure(
+        myFamily.has_value() != myGenerators.has_value(),
+        "Expected exactly one of the fields 'group' and 'generators'"
+    );
+
+    auto myQuery = Query{
+        .theId = myId.transform([](std::string_view aValue) { return std::string{aValue}; }),
+        .theGroup = FamilySpec{Family::Trivial, Degree{0}},
+        .theColourCount = orbits::ColourCount{parseNumber<std::uint32_t>(*myColours, "colours")},
+        .theMultiplicities = std::nullopt,
+    };
+
+    if (myFamily)
+    {
+        const auto myParsedFamily = parseFamily(*myFamily);
+        const auto myFixedDegree =
+            myParsedFamily == Family::Tetrahedron or myParsedFamily == Family::Cube;
+        ensure(
+            myFixedDegree or myDegree.has_value(), "Missing field 'degree' for group {}", *myFamily
+        );
+        myQuery.theGroup = FamilySpec{
+            myParsedFamily,
+            Degree{myFixedDegree ? 0uz : parseNumber<std::size_t>(*myDegree, "degree")}};
+    }
+    else
+    {
+        ensure(myDegree.has_value(), "Missing field 'degree' for generators");
+        auto mySpec = GeneratorSpec{Degree{parseNumber<std::size_t>(*myDegree, "degree")}, {}};
+        for (const auto myGenerator :
+             split(*myGenerators, [](char aCharacter) { return aCharacter == ','; }))
+        {
+            mySpec.theGenerators.push_back(parseGenerator(myGenerator));
+        }
+        myQuery.theGroup = std::move(mySpec);
+    }
+
+    if (myMultiplicities)
+    {
+        auto myCounts = std::vector<std::uint32_t>{};
+        for (const auto myCount :
+             split(*myMultiplicities, [](char aCharacter) { return aCharacter == ','; }))
+        {
+            myCounts.push_back(parseNumber<std::uint32_t>(myCount, "multiplicities"));
+        }
+        ensure(
+            myCounts.size() == myQuery.theColourCount.get(),
+            "Expected {} multiplicities, one per colour, but received {}",
+            myQuery.theColourCount.get(), myCounts.size()
+        );
+        myQuery.theMultiplicities = std::move(myCounts);
+    }
+    return myQuery;
+}
+} // namespace polya::driver
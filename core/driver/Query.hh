@@ -0,0 +1,47 @@
+#pragma once
+
+#include "core/polya-enumeration/group/GroupCatalog.hh"
+#include "core/polya-enumeration/orbit-counting/OrbitCounting.hh"
+#include "core/polya-enumeration/permutation/Permutation.hh"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace polya::driver
+{
+// A group from the catalog, e.g. group=dihedral degree=8
+struct FamilySpec
+{
+    GroupCatalog::Family theFamily;
+    Permutation::Degree theDegree;
+};
+
+// A group generated by permutations in cycle notation over {0, ..., degree - 1}, e.g.
+// generators=(0 1 2 3),(0 2) degree=4
+struct GeneratorSpec
+{
+    Permutation::Degree theDegree;
+    std::vector<std::vector<Permutation::Cycle>> theGenerators;
+};
+
+// One line of a batch: whitespace separated key=value fields, where spaces inside parentheses do
+// not separate fields. The optional id is echoed back, and multiplicities=3,2,1 asks for the
+// number of colourings that use colour i exactly multiplicities[i] times.
+//
+//   id=cube group=cube colours=3 multiplicities=3,2,1
+struct Query
+{
+    std::optional<std::string> theId;
+    std::variant<FamilySpec, GeneratorSpec> theGroup;
+    orbits::ColourCount theColourCount;
+    std::optional<std::vector<std::uint32_t>> theMultiplicities;
+
+    [[nodiscard]] auto groupKey() const -> std::string; // Equal for equal group specs
+};
+
+[[nodiscard]] auto parseQuery(std::string_view aLine) -> Query; // Throws on malformed queries
+} // namespace polya::driver
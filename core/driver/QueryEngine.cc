@@ -0,0 +1,265 @@
+#include "core/driver/QueryEngine.hh"
+
+#include "core/polya-enumeration/group/GroupCatalog.hh"
+#include "core/polya-enumeration/polya/CostEstimate.hh"
+#include "core/polya-enumeration/polya/Polya.hh"
+#include "core/util/Exception.hh"
+#include "core/util/ExecutionContext.hh"
+
+#include <exception>
+#include <mutex>
+#include <format>
+#include <stop_token>
+
+namespace polya::driver
+{
+namespace
+{
+auto jsonString(std::string_view aText) -> std::string
+{
+    auto myResult = std::string{'"'};
+    for (const auto myCharacter : aText)
+    {
+        switch (myCharacter)
+        {
+        case '"':
+            myResult += "\\\"";
+            break;
+        case '\\':
+            myResult += "\\\\";
+            break;
+        case '\n':
+            myResult += "\\n";
+            break;
+        case '\t':
+            myResult += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(myCharacter) < 0x20)
+            {
+                myResult += std::format("\\u{:04x}", static_cast<unsigned>(myCharacter));
+            }
+            else
+            {
+                myResult += myCharacter;
+            }
+        }
+    }
+    return myResult + '"';
+}
+} // namespace
+
+auto Answer::toJson() const -> std::string
+{
+    auto myJson = std::string{'{'};
+    if (theId)
+    {
+        myJson += "\"id\":" + jsonString(*theId) + ',';
+    }
+    myJson += std::format(
+        "\"group\":{},\"order\":{},\"degree\":{},\"colours\":{}", jsonString(theGroupName),
+        theOrder.get(), theDegree.get(), theColourCount.get()
+    );
+    if (theMultiplicities)
+    {
+        myJson += ",\"multiplicities\":[";
+        for (auto myIndex = 0uz; myIndex < theMultiplicities->size(); ++myIndex)
+        {
+            myJson += (myIndex == 0 ? "" : ",") + std::to_string((*theMultiplicities)[myIndex]);
+        }
+        myJson += std::format("],\"colourings\":{}}}", theCount);
+        return myJson;
+    }
+    return myJson + std::format(",\"orbits\":{}}}", theCount);
+}
+
+auto errorJson(std::size_t aLineNumber, std::string_view aMessage) -> std::string
+{
+    return std::format("{{\"line\":{},\"error\":{}}}", aLineNumber, jsonString(aMessage));
+}
+
+QueryEngine::QueryEngine(std::optional<std::uint64_t> aMemoryBudget)
+    : theMemoryBudget{aMemoryBudget}
+{
+}
+
+auto QueryEngine::answer(const Query& aQuery) -> Answer
+{
+    const auto myKey = aQuery.groupKey();
+    const auto& myGroup = group(aQuery, myKey);
+    auto myAnswer = Answer{
+        .theId = aQuery.theId,
+        .theGroupName = std::string{myGroup->name()},
+        .theOrder = myGroup->order(),
+        .theDegree = myGroup->degree(),
+        .theColourCount = aQuery.theColourCount,
+        .theMultiplicities = aQuery.theMultiplicities,
+        .theCount = 0,
+    };
+
+    if (not aQuery.theMultiplicities)
+    {
+        myAnswer.theCount = static_cast<std::int64_t>(
+            evaluateUniform(cycleIndex(aQuery, myKey), aQuery.theColourCount).get()
+        );
+        return myAnswer;
+    }
+
+    auto myExponents = std::vector<Polynomial::Exponent>{};
+    auto myTotal = 0uz;
+    for (const auto myMultiplicity : *aQuery.theMultiplicities)
+    {
+        myExponents.emplace_back(myMultiplicity);
+        myTotal += myMultiplicity;
+    }
+    // Colourings must use every point exactly once, so other totals have no colourings
+    if (myTotal == myGroup->degree().get())
+    {
+        myAnswer.theCount = colourPolynomial(aQuery, myKey)
+                                .coefficient(Polynomial::Term{std::move(myExponents)})
+                                .asInteger();
+    }
+    return myAnswer;
+}
+
+auto QueryEngine::respond(std::string_view aLine, std::size_t aLineNumber)
+    -> std::optional<Response>
+{
+    const auto myStart = aLine.find_first_not_of(" \t\r");
+    if (myStart == std::string_view::npos or aLine[myStart] == '#')
+    {
+        return std::nullopt;
+    }
+    try
+    {
+        return Response{answer(parseQuery(aLine)).toJson(), true};
+    }
+    catch (const std::exception& anException)
+    {
+        // Drop the source location that ensure prefixes to the message
+        auto myMessage = std::string_view{anException.what()};
+        if (const auto myBreak = myMessage.find("\n\t"); myBreak != std::string_view::npos)
+        {
+            myMessage.remove_prefix(myBreak + 2);
+        }
+        return Response{errorJson(aLineNumber, myMessage), false};
+    }
+}
+
+auto QueryEngine::run(std::istream& anInput, std::ostream& anOutput) -> Summary
+{
+    auto mySummary = Summary{};
+    auto myLineNumber = 0uz;
+    for (auto myLine = std::string{}; std::getline(anInput, myLine);)
+    {
+        if (const auto myResponse = respond(myLine, ++myLineNumber))
+        {
+            anOutput << myResponse->theJson << '\n';
+            ++(myResponse->theSucceeded ? mySummary.theAnswered : mySummary.theFailed);
+        }
+    }
+    return mySummary;
+}
+
+auto QueryEngine::group(const Query& aQuery, const std::string& aKey) -> const GroupPtr&
+{
+    return cached(
+        theGroups, aKey,
+        [this, &aQuery]
+        {
+            if (const auto* myFamily = std::get_if<FamilySpec>(&aQuery.theGroup))
+            {
+                if (theMemoryBudget)
+                {
+                    admit(
+                        estimateGroupBytes(
+                            GroupCatalog::degree(myFamily->theFamily, myFamily->theDegree),
+                            GroupCatalog::order(myFamily->theFamily, myFamily->theDegree)
+                        ),
+                        "group generation"
+                    );
+                }
+                return GroupCatalog::instance().get(myFamily->theFamily, myFamily->theDegree);
+            }
+            const auto& mySpec = std::get<GeneratorSpec>(aQuery.theGroup);
+            auto myGenerators = std::vector<Permutation>{};
+            for (const auto& myCycles : mySpec.theGenerators)
+            {
+                myGenerators.emplace_back(mySpec.theDegree, myCycles);
+            }
+
+            // The order is unknown until generated, so the elements found so far and the
+            // candidates of the next layer are checked against the budget at each checkpoint
+            auto myContext = ExecutionContext{};
+            if (theMemoryBudget)
+            {
+                myContext = ExecutionContext{
+                    std::stop_token{}, std::nullopt,
+                    [this, myElementBytes = estimateGroupBytes(mySpec.theDegree, 1)](
+                        const ExecutionContext::Progress& aProgress
+                    ) { admit(aProgress.theProcessed * myElementBytes, "group generation"); }};
+            }
+            return GroupPtr{std::make_shared<const PermutationGroup>(
+                "generated", mySpec.theDegree,
+                PermutationGroup::Generators{std::move(myGenerators)}, myContext
+            )};
+        }
+    );
+}
+
+auto QueryEngine::cycleIndex(const Query& aQuery, const std::string& aKey)
+    -> const CycleIndexPolynomial&
+{
+    return cached(
+        theCycleIndices, aKey,
+        [&] { return cycleIndexPolynomial(*group(aQuery, aKey)); }
+    );
+}
+
+auto QueryEngine::colourPolynomial(const Query& aQuery, const std::string& aKey)
+    -> const SymmetricPolynomial&
+{
+    return cached(
+        theColourPolynomials, std::pair{aKey, aQuery.theColourCount.get()},
+        [&]
+        {
+            const auto& myCycleIndex = cycleIndex(aQuery, aKey);
+            if (theMemoryBudget)
+            {
+                admit(
+                    estimateCost(*group(aQuery, aKey), aQuery.theColourCount).theSymmetricBytes,
+                    "colour evaluation"
+                );
+            }
+            return evaluateSymmetricColours(myCycleIndex, aQuery.theColourCount);
+        }
+    );
+}
+
+auto QueryEngine::admit(std::uint64_t anEstimatedBytes, std::string_view aStage) const -> void
+{
+    ensure(
+        not theMemoryBudget or anEstimatedBytes <= *theMemoryBudget,
+        "Estimated {} memory of {} MiB exceeds the budget of {} MiB", aStage,
+        anEstimatedBytes >> 20, theMemoryBudget.value_or(0) >> 20
+    );
+}
+
+template <typename Map, typename Build>
+auto QueryEngine::cached(Map& aMap, const typename Map::key_type& aKey, Build aBuild)
+    -> const typename Map::mapped_type&
+{
+    {
+        const auto myLock = std::shared_lock{theMutex};
+        if (const auto myEntry = aMap.find(aKey); myEntry != aMap.end())
+        {
+            return myEntry->second;
+        }
+    }
+    // Built outside the lock so that queries on other keys are not held up. Concurrent misses on
+    // one key may build it twice; the first insertion wins.
+    auto myValue = aBuild();
+    const auto myLock = std::unique_lock{theMutex};
+    return aMap.try_emplace(aKey, std::move(myValue)).first->second;
+}
+} // namespace polya::driver
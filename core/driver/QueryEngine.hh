@@ -0,0 +1,95 @@
+#pragma once
+
+#include "core/driver/Query.hh"
+#include "core/polya-enumeration/cycle-index/CycleIndexPolynomial.hh"
+#include "core/polya-enumeration/group/PermutationGroup.hh"
+#include "core/polya-enumeration/polynomial/Polynomial.hh"
+#include "core/polya-enumeration/polynomial/SymmetricPolynomial.hh"
+
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace polya::driver
+{
+struct Answer
+{
+    std::optional<std::string> theId;
+    std::string theGroupName;
+    PermutationGroup::Order theOrder;
+    Permutation::Degree theDegree;
+    orbits::ColourCount theColourCount;
+    std::optional<std::vector<std::uint32_t>> theMultiplicities;
+    std::int64_t theCount; // Orbits, or colourings with the requested multiplicities
+
+    [[nodiscard]] auto toJson() const -> std::string; // One line, without a trailing newline
+};
+
+[[nodiscard]] auto errorJson(std::size_t aLineNumber, std::string_view aMessage) -> std::string;
+
+// Answers queries, caching the groups, cycle indices and colour polynomials they need so that a
+// long batch over a few groups only builds each of them once. Safe to share between threads;
+// cached entries are never evicted.
+//
+// With a memory budget, queries are rejected before building a catalog group or a colour
+// polynomial whose estimated working set (see CostEstimate) exceeds it. The order of a group from
+// generators is not known before, so its generation stops once the elements found so far exceed
+// the budget.
+class QueryEngine
+{
+public:
+    struct Summary
+    {
+        std::size_t theAnswered = 0;
+        std::size_t theFailed = 0;
+    };
+
+    struct Response
+    {
+        std::string theJson; // An answer or an error object, without a trailing newline
+        bool theSucceeded;
+    };
+
+    explicit QueryEngine(std::optional<std::uint64_t> aMemoryBudget = std::nullopt); // Bytes
+
+    [[nodiscard]] auto answer(const Query& aQuery) -> Answer; // Throws on failing queries
+
+    // Answers one line of a batch; empty for blank lines and # comments
+    [[nodiscard]] auto respond(std::string_view aLine, std::size_t aLineNumber)
+        -> std::optional<Response>;
+
+    // Answers one query per line, writing line-delimited JSON. Blank lines and lines starting with
+    // # are skipped; malformed or failing queries produce an error object and do not stop the run.
+    auto run(std::istream& anInput, std::ostream& anOutput) -> Summary;
+
+private:
+    using GroupPtr = std::shared_ptr<const PermutationGroup>;
+
+    [[nodiscard]] auto group(const Query& aQuery, const std::string& aKey) -> const GroupPtr&;
+    [[nodiscard]] auto cycleIndex(const Query& aQuery, const std::string& aKey)
+        -> const CycleIndexPolynomial&;
+    [[nodiscard]] auto colourPolynomial(const Query& aQuery, const std::string& aKey)
+        -> const SymmetricPolynomial&;
+
+    auto admit(std::uint64_t anEstimatedBytes, std::string_view aStage) const -> void;
+
+    template <typename Map, typename Build>
+    [[nodiscard]] auto cached(Map& aMap, const typename Map::key_type& aKey, Build aBuild)
+        -> const typename Map::mapped_type&;
+
+    std::optional<std::uint64_t> theMemoryBudget;
+    std::shared_mutex theMutex; // Guards the caches; entries are stable once inserted
+    std::unordered_map<std::string, GroupPtr> theGroups;
+    std::unordered_map<std::string, CycleIndexPolynomial> theCycleIndices;
+    std::map<std::pair<std::string, std::uint32_t>, SymmetricPolynomial> theColourPolynomials;
+};
+} // namespace polya::driver
@@ -0,0 +1,427 @@
+#include "core/driver/Server.hh"
+
+#include "core/util/Exception.hh"
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <map>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace polya::driver
+{
+namespace
+{
+constexpr auto theMaximumQueued = 4096uz;
+constexpr auto thePollInterval = 100; // Milliseconds between checks for stop()
+constexpr auto theMaximumLineLength = 1uz << 20;
+// A connection stops reading requests while this many are unanswered or this many response bytes
+// are unsent, so a client that pipelines without reading holds a bounded amount of memory
+constexpr auto theMaximumInFlight = 1024uz;
+constexpr auto theMaximumUnsent = 1uz << 20;
+constexpr auto theTooManyConnections = std::string_view{"{\"error\":\"Too many connections\"}\n"};
+
+// Waits up to the poll interval for the socket to become readable
+auto readable(int aSocket) -> bool
+{
+    auto myPoll = pollfd{.fd = aSocket, .events = POLLIN, .revents = 0};
+    return poll(&myPoll, 1, thePollInterval) > 0;
+}
+
+// The device and inode of aPath if it is a socket, without following symbolic links
+auto socketFile(const std::string& aPath) -> std::optional<std::pair<std::uint64_t, std::uint64_t>>
+{
+    struct stat myStatus = {};
+    if (lstat(aPath.c_str(), &myStatus) != 0 or not S_ISSOCK(myStatus.st_mode))
+    {
+        return std::nullopt;
+    }
+    return std::pair{std::uint64_t{myStatus.st_dev}, std::uint64_t{myStatus.st_ino}};
+}
+
+auto trimmed(std::string_view aLine) -> std::string_view
+{
+    const auto myStart = aLine.find_first_not_of(" \t\r");
+    if (myStart == std::string_view::npos)
+    {
+        return {};
+    }
+    return aLine.substr(myStart, aLine.find_last_not_of(" \t\r") - myStart + 1);
+}
+} // namespace
+
+// Responses are sent in request order: a worker that finishes out of order parks its response
+// until all earlier ones are ready. Workers only append to the output, which the connection's own
+// thread sends as the socket accepts it, so a client that does not read never blocks a worker.
+struct Server::Connection
+{
+    explicit Connection(int aSocket)
+        : theSocket{aSocket}, theWakeup{eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)}
+    {
+    }
+    ~Connection()
+    {
+        close(theWakeup);
+        close(theSocket);
+    }
+
+    Connection(const Connection&) = delete;
+    auto operator=(const Connection&) -> Connection& = delete;
+
+    // Empty responses (blank lines, comments) only advance the sequence
+    auto complete(std::uint64_t aSequence, std::optional<std::string> aResponse) -> void
+    {
+        {
+            const auto myLock = std::scoped_lock{theMutex};
+            theFinished.emplace(aSequence, std::move(aResponse));
+            while (not theFinished.empty() and theFinished.begin()->first == theNextToSend)
+            {
+                if (const auto& myResponse = theFinished.begin()->second)
+                {
+                    theOutput += *myResponse;
+                    theOutput += '\n';
+                }
+                theFinished.erase(theFinished.begin());
+                ++theNextToSend;
+            }
+        }
+        const auto myOne = std::uint64_t{1};
+        static_cast<void>(write(theWakeup, &myOne, sizeof(myOne)));
+    }
+
+    int theSocket;
+    int theWakeup; // Signalled by workers when output is ready
+    std::mutex theMutex;
+    std::uint64_t theNextToSend = 0;
+    std::map<std::uint64_t, std::optional<std::string>> theFinished;
+    std::string theOutput; // Responses in order, not yet taken by the connection's thread
+};
+
+auto Endpoint::parse(std::string_view aText) -> Endpoint
+{
+    if (aText.starts_with("unix:") and aText.size() > 5)
+    {
+        const auto myPath = aText.substr(5);
+        ensure(
+            myPath.size() < sizeof(sockaddr_un::sun_path), "Socket path {} is too long", myPath
+        );
+        return Endpoint{Kind::Unix, std::string{myPath}, 0};
+    }
+    if (aText.starts_with("tcp:"))
+    {
+        const auto myPort = aText.substr(4);
+        auto myValue = std::uint16_t{0};
+        const auto [myEnd, myError] =
+            std::from_chars(myPort.data(), myPort.data() + myPort.size(), myValue);
+        ensure(
+            not myPort.empty() and myError == std::errc{}
+                and myEnd == myPort.data() + myPort.size(),
+            "Invalid TCP port '{}'", myPort
+        );
+        return Endpoint{Kind::Tcp, {}, myValue};
+    }
+    throw_runtime_error("Expected unix:<path> or tcp:<port>, but received '{}'", aText);
+    std::unreachable();
+}
+
+Server::Server(
+    QueryEngine& anEngine, const Endpoint& anEndpoint, std::size_t aWorkerCount,
+    std::size_t aConnectionLimit
+)
+    : theEngine{anEngine}, theEndpoint{anEndpoint}, theConnectionLimit{aConnectionLimit}
+{
+    ensure(aWorkerCount > 0, "A server needs at least one worker");
+    ensure(aConnectionLimit > 0, "A server needs to accept at least one connection");
+    if (theEndpoint.theKind == Endpoint::Kind::Unix)
+    {
+        theListener = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        ensure(theListener != -1, "Could not create socket: {}", std::strerror(errno));
+        auto myAddress = sockaddr_un{};
+        myAddress.sun_family = AF_UNIX;
+        std::ranges::copy(theEndpoint.thePath, myAddress.sun_path);
+        if (socketFile(theEndpoint.thePath))
+        {
+            unlink(theEndpoint.thePath.c_str()); // Left behind by a previous run
+        }
+        ensure(
+            bind(theListener, reinterpret_cast<const sockaddr*>(&myAddress), sizeof(myAddress))
+                == 0,
+            "Could not bind {}: {}", theEndpoint.thePath, std::strerror(errno)
+        );
+        theSocketFile = socketFile(theEndpoint.thePath);
+    }
+    else
+    {
+        theListener = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        ensure(theListener != -1, "Could not create socket: {}", std::strerror(errno));
+        const auto myReuse = 1;
+        setsockopt(theListener, SOL_SOCKET, SO_REUSEADDR, &myReuse, sizeof(myReuse));
+        auto myAddress = sockaddr_in{};
+        myAddress.sin_family = AF_INET;
+        myAddress.sin_port = htons(theEndpoint.thePort);
+        myAddress.sin_addr.s_addr = htonl(INADDR_LOOPBACK); // Local clients only
+        ensure(
+            bind(theListener, reinterpret_cast<const sockaddr*>(&myAddress), sizeof(myAddress))
+                == 0,
+            "Could not bind 127.0.0.1:{}: {}", theEndpoint.thePort, std::strerror(errno)
+        );
+        auto myLength = socklen_t{sizeof(myAddress)};
+        getsockname(theListener, reinterpret_cast<sockaddr*>(&myAddress), &myLength);
+        thePort = ntohs(myAddress.sin_port);
+    }
+    ensure(listen(theListener, SOMAXCONN) == 0, "Could not listen: {}", std::strerror(errno));
+
+    theWorkers.reserve(aWorkerCount);
+    for (auto myIndex = 0uz; myIndex < aWorkerCount; ++myIndex)
+    {
+        theWorkers.emplace_back([this] { work(); });
+    }
+}
+
+Server::~Server()
+{
+    stop();
+    theReaders.clear(); // Readers notice stop() within a poll interval
+    theWorkers.clear();
+    close(theListener);
+    // Unless it was since replaced, e.g. by another server bound to the same path
+    if (theSocketFile and socketFile(theEndpoint.thePath) == theSocketFile)
+    {
+        unlink(theEndpoint.thePath.c_str());
+    }
+}
+
+auto Server::port() const -> std::uint16_t
+{
+    return thePort;
+}
+
+auto Server::run() -> void
+{
+    while (not theStopping.load(std::memory_order_relaxed))
+    {
+        if (not readable(theListener))
+        {
+            continue;
+        }
+        const auto mySocket = accept4(theListener, nullptr, nullptr, SOCK_CLOEXEC | SOCK_NONBLOCK);
+        if (mySocket == -1)
+        {
+            continue;
+        }
+        const auto myLock = std::scoped_lock{theReadersMutex};
+        std::erase_if(
+            theReaders, [](const Reader& aReader) { return aReader.theDone->load(); }
+        );
+        if (theReaders.size() >= theConnectionLimit)
+        {
+            // Best effort on the fresh socket buffer; the client then sees the connection close
+            static_cast<void>(send(
+                mySocket, theTooManyConnections.data(), theTooManyConnections.size(),
+                MSG_NOSIGNAL
+            ));
+            close(mySocket);
+            continue;
+        }
+
+        auto myConnection = std::make_shared<Connection>(mySocket);
+        if (myConnection->theWakeup == -1)
+        {
+            continue; // Out of descriptors; the client sees the connection close
+        }
+        auto myDone = std::make_shared<std::atomic<bool>>(false);
+        theReaders.push_back(Reader{
+            myDone,
+            std::jthread{[this, myConnection = std::move(myConnection), myDone]() mutable
+                         {
+                             serve(std::move(myConnection));
+                             myDone->store(true);
+                         }}});
+    }
+}
+
+auto Server::stop() -> void
+{
+    {
+        const auto myLock = std::scoped_lock{theQueueMutex};
+        theStopping.store(true, std::memory_order_relaxed);
+    }
+    theQueueChanged.notify_all();
+}
+
+auto Server::latencies() const -> const LatencyHistogram&
+{
+    return theLatencies;
+}
+
+auto Server::serve(std::shared_ptr<Connection> aConnection) -> void
+{
+    auto& myConnection = *aConnection;
+    auto myInput = std::string{};
+    auto myOutput = std::string{}; // Taken from the connection, sent from mySent on
+    auto mySent = 0uz;
+    auto mySequence = std::uint64_t{0};
+    auto myLineNumber = 0uz;
+    auto myEndOfInput = false;
+    char myChunk[4096];
+    while (not theStopping.load(std::memory_order_relaxed))
+    {
+        auto myInFlight = 0uz;
+        auto myUnsent = 0uz;
+        {
+            const auto myLock = std::scoped_lock{myConnection.theMutex};
+            if (mySent == myOutput.size())
+            {
+                myOutput.clear();
+                mySent = 0;
+                std::swap(myOutput, myConnection.theOutput);
+            }
+            myInFlight = mySequence - myConnection.theNextToSend;
+            myUnsent = myOutput.size() - mySent + myConnection.theOutput.size();
+        }
+        if (myEndOfInput and myInFlight == 0 and myUnsent == 0)
+        {
+            return; // Closed by the client and every response sent
+        }
+
+        const auto myReading = not myEndOfInput and myInFlight < theMaximumInFlight
+                               and myUnsent < theMaximumUnsent;
+        const auto myWriting = mySent < myOutput.size();
+        pollfd myPolls[] = {
+            {.fd = myConnection.theSocket,
+             .events = static_cast<short>((myReading ? POLLIN : 0) | (myWriting ? POLLOUT : 0)),
+             .revents = 0},
+            {.fd = myConnection.theWakeup, .events = POLLIN, .revents = 0},
+        };
+        if (poll(myPolls, 2, thePollInterval) <= 0)
+        {
+            continue;
+        }
+        if ((myPolls[1].revents & POLLIN) != 0)
+        {
+            auto myCount = std::uint64_t{0};
+            static_cast<void>(read(myConnection.theWakeup, &myCount, sizeof(myCount)));
+        }
+        if ((myPolls[0].revents & (POLLERR | POLLHUP | POLLNVAL)) != 0)
+        {
+            return; // The client went away; remaining responses are dropped
+        }
+
+        if ((myPolls[0].revents & POLLOUT) != 0)
+        {
+            const auto mySentNow = send(
+                myConnection.theSocket, myOutput.data() + mySent, myOutput.size() - mySent,
+                MSG_NOSIGNAL
+            );
+            if (mySentNow < 0 and errno != EAGAIN and errno != EWOULDBLOCK)
+            {
+                return;
+            }
+            mySent += static_cast<std::size_t>(std::max(mySentNow, ssize_t{0}));
+        }
+
+        if ((myPolls[0].revents & POLLIN) != 0)
+        {
+            const auto myReceived = recv(myConnection.theSocket, myChunk, sizeof(myChunk), 0);
+            if (myReceived == 0)
+            {
+                myEndOfInput = true; // Pending responses are still sent
+                continue;
+            }
+            if (myReceived < 0)
+            {
+                if (errno != EAGAIN and errno != EWOULDBLOCK)
+                {
+                    return;
+                }
+                continue;
+            }
+            myInput.append(myChunk, static_cast<std::size_t>(myReceived));
+
+            auto myStart = 0uz;
+            for (auto myEnd = myInput.find('\n'); myEnd != std::string::npos;
+                 myEnd = myInput.find('\n', myStart))
+            {
+                submit(Request{
+                    aConnection, mySequence++, ++myLineNumber,
+                    myInput.substr(myStart, myEnd - myStart), std::chrono::steady_clock::now()});
+                myStart = myEnd + 1;
+            }
+            myInput.erase(0, myStart);
+            if (myInput.size() > theMaximumLineLength)
+            {
+                return; // Not a line based client
+            }
+        }
+    }
+}
+
+auto Server::submit(Request aRequest) -> void
+{
+    {
+        auto myLock = std::unique_lock{theQueueMutex};
+        theQueueChanged.wait(
+            myLock,
+            [this]
+            {
+                return theQueue.size() < theMaximumQueued
+                       or theStopping.load(std::memory_order_relaxed);
+            }
+        );
+        theQueue.push_back(std::move(aRequest));
+    }
+    theQueueChanged.notify_all();
+}
+
+auto Server::work() -> void
+{
+    while (true)
+    {
+        auto myRequest = [this]() -> std::optional<Request>
+        {
+            auto myLock = std::unique_lock{theQueueMutex};
+            theQueueChanged.wait(
+                myLock,
+                [this]
+                { return not theQueue.empty() or theStopping.load(std::memory_order_relaxed); }
+            );
+            if (theQueue.empty())
+            {
+                return std::nullopt;
+            }
+            auto myFront = std::move(theQueue.front());
+            theQueue.pop_front();
+            return myFront;
+        }();
+        if (not myRequest)
+        {
+            return;
+        }
+        theQueueChanged.notify_all(); // Room for a waiting reader
+
+        auto myResponse = std::optional<std::string>{};
+        if (trimmed(myRequest->theLine) == "stats")
+        {
+            myResponse = "{\"latency\":" + theLatencies.toJson() + '}';
+        }
+        else if (auto myAnswer = theEngine.respond(myRequest->theLine, myRequest->theLineNumber))
+        {
+            myResponse = std::move(myAnswer->theJson);
+            theLatencies.record(std::chrono::steady_clock::now() - myRequest->theReceived);
+        }
+        myRequest->theConnection->complete(myRequest->theSequence, std::move(myResponse));
+    }
+}
+} // namespace polya::driver
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "core/driver/LatencyHistogram.hh"
+#include "core/driver/QueryEngine.hh"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace polya::driver
+{
+// Where the server listens: unix:<path> for a Unix domain socket, or tcp:<port> for a TCP port on
+// 127.0.0.1 (port 0 picks a free port)
+struct Endpoint
+{
+    enum class Kind : std::uint8_t
+    {
+        Unix,
+        Tcp,
+    };
+
+    Kind theKind;
+    std::string thePath;
+    std::uint16_t thePort = 0;
+
+    [[nodiscard]] static auto parse(std::string_view aText) -> Endpoint; // Throws if malformed
+};
+
+// Serves the batch query protocol over a socket. Each connection sends queries one per line and
+// receives one JSON line per query, in request order, so clients may pipeline many requests
+// before reading; a connection stops reading once too many of its responses are pending, so a
+// client that never reads only holds up itself. The line "stats" returns the latency histogram
+// instead. Requests from all connections are answered by a fixed pool of workers sharing one
+// QueryEngine, and so its caches. Each open connection has a reader thread, so at most
+// aConnectionLimit are served at once; further clients receive an error line and are closed.
+class Server
+{
+public:
+    static constexpr auto theDefaultConnectionLimit = 256uz;
+
+    Server(
+        QueryEngine& anEngine, const Endpoint& anEndpoint, std::size_t aWorkerCount,
+        std::size_t aConnectionLimit = theDefaultConnectionLimit
+    );
+    ~Server(); // Stops the server
+
+    Server(const Server&) = delete;
+    auto operator=(const Server&) -> Server& = delete;
+
+    [[nodiscard]] auto port() const -> std::uint16_t; // Bound TCP port, e.g. after tcp:0
+
+    auto run() -> void;  // Accepts connections until stop()
+    auto stop() -> void; // Safe to call from any thread
+
+    [[nodiscard]] auto latencies() const -> const LatencyHistogram&;
+
+private:
+    struct Connection;
+    struct Request
+    {
+        std::shared_ptr<Connection> theConnection;
+        std::uint64_t theSequence;
+        std::size_t theLineNumber;
+        std::string theLine;
+        std::chrono::steady_clock::time_point theReceived;
+    };
+
+    auto serve(std::shared_ptr<Connection> aConnection) -> void; // Reads one connection
+    auto work() -> void;
+    auto submit(Request aRequest) -> void;
+
+    QueryEngine& theEngine;
+    Endpoint theEndpoint;
+    std::optional<std::pair<std::uint64_t, std::uint64_t>> theSocketFile; // Device and inode
+    int theListener = -1;
+    std::uint16_t thePort = 0;
+    std::atomic<bool> theStopping{false};
+    LatencyHistogram theLatencies;
+
+    std::mutex theQueueMutex;
+    std::condition_variable theQueueChanged;
+    std::deque<Request> theQueue; // Bounded; readers wait for space, which pushes back on clients
+
+    struct Reader
+    {
+        std::shared_ptr<std::atomic<bool>> theDone;
+        std::jthread theThread;
+    };
+    std::size_t theConnectionLimit;
+    std::mutex theReadersMutex;
+    std::vector<Reader> theReaders; // One per open connection, pruned as connections close
+    std::vector<std::jthread> theWorkers;
+};
+} // namespace polya::driver
@@ -0,0 +1,53 @@
+#include "core/driver/LatencyHistogram.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace polya::test
+{
+using namespace ::testing;
+using namespace std::chrono_literals;
+using driver::LatencyHistogram;
+
+class LatencyHistogramTest : public ::testing::Test
+{
+};
+
+TEST_F(LatencyHistogramTest, BucketsByPowersOfTwo)
+{
+    auto myHistogram = LatencyHistogram{};
+    myHistogram.record(500ns);
+    myHistogram.record(1us);
+    myHistogram.record(3us);
+    myHistogram.record(3ms);
+    EXPECT_THAT(myHistogram.count(), Eq(4u));
+    EXPECT_THAT(myHistogram.bucket(0), Eq(1u));
+    EXPECT_THAT(myHistogram.bucket(1), Eq(1u));
+    EXPECT_THAT(myHistogram.bucket(2), Eq(1u));
+    EXPECT_THAT(myHistogram.bucket(12), Eq(1u));
+}
+
+TEST_F(LatencyHistogramTest, QuantilesAreBucketUpperBounds)
+{
+    auto myHistogram = LatencyHistogram{};
+    for (auto myIndex = 0; myIndex < 99; ++myIndex)
+    {
+        myHistogram.record(10us);
+    }
+    myHistogram.record(1s);
+    EXPECT_THAT(myHistogram.quantile(0.5), Eq(16us));
+    EXPECT_THAT(myHistogram.quantile(0.99), Eq(16us));
+    EXPECT_THAT(myHistogram.quantile(1.0), Eq(std::chrono::microseconds{1 << 20}));
+}
+
+TEST_F(LatencyHistogramTest, EmptyHistogramIsZero)
+{
+    const auto myHistogram = LatencyHistogram{};
+    EXPECT_THAT(myHistogram.count(), Eq(0u));
+    EXPECT_THAT(myHistogram.quantile(0.99), Eq(0us));
+    EXPECT_THAT(
+        myHistogram.toJson(),
+        Eq("{\"count\":0,\"p50_us\":0,\"p90_us\":0,\"p99_us\":0,\"buckets_us\":{}}")
+    );
+}
+} // namespace polya::test
@@ -0,0 +1,134 @@
+#include "core/driver/QueryEngine.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+namespace polya::test
+{
+using namespace ::testing;
+using namespace driver;
+
+class QueryEngineTest : public ::testing::Test
+{
+};
+
+TEST_F(QueryEngineTest, CountsOrbits)
+{
+    auto myEngine = QueryEngine{};
+    const auto myAnswer = myEngine.answer(parseQuery("group=cube colours=3"));
+    EXPECT_THAT(myAnswer.theCount, Eq(57));
+    EXPECT_THAT(myAnswer.theOrder.get(), Eq(24u));
+}
+
+TEST_F(QueryEngineTest, NoColoursGiveNoOrbits)
+{
+    auto myEngine = QueryEngine{};
+    EXPECT_THAT(myEngine.answer(parseQuery("group=cube colours=0")).theCount, Eq(0));
+    auto myBudgeted = QueryEngine{std::uint64_t{1} << 20};
+    EXPECT_THAT(myBudgeted.answer(parseQuery("group=cube colours=0")).theCount, Eq(0));
+}
+
+TEST_F(QueryEngineTest, CountsColouringsWithMultiplicities)
+{
+    auto myEngine = QueryEngine{};
+    EXPECT_THAT(
+        myEngine.answer(parseQuery("group=cube colours=3 multiplicities=3,2,1")).theCount, Eq(3)
+    );
+    EXPECT_THAT(
+        myEngine.answer(parseQuery("group=cube colours=3 multiplicities=3,2,2")).theCount, Eq(0)
+    );
+}
+
+TEST_F(QueryEngineTest, GeneratedGroupsMatchCatalogGroups)
+{
+    auto myEngine = QueryEngine{};
+    EXPECT_THAT(
+        myEngine.answer(parseQuery("generators=(0 1 2 3 4 5),(1 5)(2 4) degree=6 colours=2"))
+            .theCount,
+        Eq(myEngine.answer(parseQuery("group=dihedral degree=6 colours=2")).theCount)
+    );
+}
+
+TEST_F(QueryEngineTest, RejectsGeneratorsThatAreNotBijections)
+{
+    auto myEngine = QueryEngine{};
+    for (const auto* myLine :
+         {"generators=(0 1)(1 2) degree=3 colours=2", "generators=(0 0 1) degree=3 colours=2"})
+    {
+        const auto myResponse = myEngine.respond(myLine, 1);
+        ASSERT_THAT(myResponse.has_value(), IsTrue());
+        EXPECT_THAT(myResponse->theSucceeded, IsFalse());
+        EXPECT_THAT(myResponse->theJson, HasSubstr("appears more than once"));
+    }
+}
+
+TEST_F(QueryEngineTest, RejectsCountsPast63Bits)
+{
+    // The identity term 2^64 used to wrap to zero and give the true count less 2^58
+    auto myEngine = QueryEngine{};
+    const auto myResponse = myEngine.respond("group=cyclic degree=64 colours=2", 1);
+    ASSERT_THAT(myResponse.has_value(), IsTrue());
+    EXPECT_THAT(myResponse->theSucceeded, IsFalse());
+    EXPECT_THAT(myResponse->theJson, HasSubstr("to fit in 64 bits"));
+}
+
+TEST_F(QueryEngineTest, WritesOneJsonLinePerQuery)
+{
+    auto myEngine = QueryEngine{};
+    auto myInput = std::istringstream{
+        "# necklaces\n"
+        "id=a group=cyclic degree=4 colours=2\n"
+        "\n"
+        "group=cyclic degree=4 colours=2 multiplicities=2,2\n"
+        "group=cyclic degree=4\n"};
+    auto myOutput = std::ostringstream{};
+    const auto mySummary = myEngine.run(myInput, myOutput);
+    EXPECT_THAT(mySummary.theAnswered, Eq(2u));
+    EXPECT_THAT(mySummary.theFailed, Eq(1u));
+    EXPECT_THAT(
+        myOutput.str(),
+        StartsWith(
+            "{\"id\":\"a\",\"group\":\"C_4\",\"order\":4,\"degree\":4,\"colours\":2,\"orbits\":6}\n"
+            "{\"group\":\"C_4\",\"order\":4,\"degree\":4,\"colours\":2,\"multiplicities\":[2,2],"
+            "\"colourings\":2}\n"
+            "{\"line\":5,\"error\":"
+        )
+    );
+}
+
+TEST_F(QueryEngineTest, RejectsQueriesOverTheMemoryBudget)
+{
+    auto myEngine = QueryEngine{std::uint64_t{1} << 20};
+    EXPECT_THAT(myEngine.answer(parseQuery("group=cube colours=3")).theCount, Eq(57));
+
+    const auto myHugeGroup = myEngine.respond("group=symmetric degree=20 colours=2", 1);
+    ASSERT_THAT(myHugeGroup.has_value(), IsTrue());
+    EXPECT_THAT(myHugeGroup->theSucceeded, IsFalse());
+    EXPECT_THAT(myHugeGroup->theJson, HasSubstr("group generation memory"));
+
+    // Groups from generators are checked while generating: S_4 fits, S_8 with 40320 elements not
+    EXPECT_THAT(
+        myEngine.answer(parseQuery("generators=(0 1 2 3),(0 1) degree=4 colours=2")).theCount,
+        Eq(5)
+    );
+    const auto myGenerated =
+        myEngine.respond("generators=(0 1 2 3 4 5 6 7),(0 1) degree=8 colours=2", 2);
+    ASSERT_THAT(myGenerated.has_value(), IsTrue());
+    EXPECT_THAT(myGenerated->theSucceeded, IsFalse());
+    EXPECT_THAT(myGenerated->theJson, HasSubstr("group generation memory"));
+
+    // Colour polynomials are held as partitions, 37338 of them for 40 points and colours
+    auto myQuery = std::string{"group=cyclic degree=40 colours=40 multiplicities=1"};
+    for (auto myColour = 1; myColour < 40; ++myColour)
+    {
+        myQuery += ",1";
+    }
+    const auto myManyColours = myEngine.respond(myQuery, 3);
+    ASSERT_THAT(myManyColours.has_value(), IsTrue());
+    EXPECT_THAT(myManyColours->theSucceeded, IsFalse());
+    EXPECT_THAT(myManyColours->theJson, HasSubstr("colour evaluation memory"));
+}
+} // namespace polya::test
@@ -0,0 +1,99 @@
+#include "core/driver/Query.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+namespace polya::test
+{
+using namespace ::testing;
+using namespace driver;
+using Family = GroupCatalog::Family;
+using Element = Permutation::Element;
+
+class QueryTest : public ::testing::Test
+{
+};
+
+TEST_F(QueryTest, ParsesFamilyQuery)
+{
+    const auto myQuery = parseQuery("group=dihedral degree=8 colours=3");
+    const auto& myGroup = std::get<FamilySpec>(myQuery.theGroup);
+    EXPECT_THAT(myGroup.theFamily, Eq(Family::Dihedral));
+    EXPECT_THAT(myGroup.theDegree.get(), Eq(8u));
+    EXPECT_THAT(myQuery.theColourCount.get(), Eq(3u));
+    EXPECT_FALSE(myQuery.theId.has_value());
+    EXPECT_FALSE(myQuery.theMultiplicities.has_value());
+}
+
+TEST_F(QueryTest, FixedDegreeFamiliesNeedNoDegree)
+{
+    const auto myQuery = parseQuery("id=faces group=cube colours=3 multiplicities=3,2,1");
+    EXPECT_THAT(std::get<FamilySpec>(myQuery.theGroup).theFamily, Eq(Family::Cube));
+    EXPECT_THAT(myQuery.theId, Optional(Eq("faces")));
+    EXPECT_THAT(myQuery.theMultiplicities, Optional(ElementsAre(3u, 2u, 1u)));
+}
+
+TEST_F(QueryTest, ParsesGeneratorsInCycleNotation)
+{
+    const auto myQuery = parseQuery("generators=(0 1 2 3),(0 2)(1 3) degree=4 colours=2");
+    const auto& myGroup = std::get<GeneratorSpec>(myQuery.theGroup);
+    EXPECT_THAT(myGroup.theDegree.get(), Eq(4u));
+    ASSERT_THAT(myGroup.theGenerators.size(), Eq(2u));
+    EXPECT_THAT(myGroup.theGenerators[0].size(), Eq(1u));
+    EXPECT_THAT(myGroup.theGenerators[1][1].get(), ElementsAre(Element{1}, Element{3}));
+}
+
+TEST_F(QueryTest, EqualGroupsShareKeys)
+{
+    EXPECT_THAT(
+        parseQuery("generators=(0 1 2) degree=3 colours=2").groupKey(),
+        Eq(parseQuery("generators=(1 2 0) degree=3 colours=5").groupKey())
+    );
+    EXPECT_THAT(
+        parseQuery("group=cyclic degree=3 colours=2").groupKey(),
+        Ne(parseQuery("group=symmetric degree=3 colours=2").groupKey())
+    );
+}
+
+TEST_F(QueryTest, MalformedQueriesThrow)
+{
+    EXPECT_THROW(static_cast<void>(parseQuery("group=cyclic degree=4")), std::runtime_error);
+    EXPECT_THROW(
+        static_cast<void>(parseQuery("group=prism degree=4 colours=2")), std::runtime_error
+    );
+    EXPECT_THROW(static_cast<void>(parseQuery("group=cyclic colours=2")), std::runtime_error);
+    EXPECT_THROW(
+        static_cast<void>(parseQuery("group=cyclic degree=four colours=2")), std::runtime_error
+    );
+    EXPECT_THROW(
+        static_cast<void>(parseQuery("group=cyclic degree=4 colours=2 shape=round")),
+        std::runtime_error
+    );
+    EXPECT_THROW(
+        static_cast<void>(parseQuery("group=cyclic degree=4 colours=2 multiplicities=4")),
+        std::runtime_error
+    );
+    EXPECT_THROW(
+        static_cast<void>(parseQuery("generators=(0 1 degree=2 colours=2")), std::runtime_error
+    );
+}
+
+TEST_F(QueryTest, GeneratorsWithRepeatedElementsThrow)
+{
+    EXPECT_THROW(
+        static_cast<void>(parseQuery("generators=(0 1)(1 2) degree=3 colours=2")),
+        std::runtime_error
+    );
+    EXPECT_THROW(
+        static_cast<void>(parseQuery("generators=(0 0 1) degree=3 colours=2")), std::runtime_error
+    );
+    // Elements may repeat across generators, just not within one
+    EXPECT_THAT(
+        std::get<GeneratorSpec>(parseQuery("generators=(0 1),(1 2) degree=3 colours=2").theGroup)
+            .theGenerators.size(),
+        Eq(2u)
+    );
+}
+} // namespace polya::test
@@ -0,0 +1,220 @@
+#include "core/driver/Server.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace polya::test
+{
+using namespace ::testing;
+using namespace driver;
+
+namespace
+{
+// A small receive buffer makes a client that does not read stall the server's sends sooner
+auto connectTo(std::uint16_t aPort, int aReceiveBuffer = 0) -> int
+{
+    const auto mySocket = socket(AF_INET, SOCK_STREAM, 0);
+    if (aReceiveBuffer > 0)
+    {
+        setsockopt(mySocket, SOL_SOCKET, SO_RCVBUF, &aReceiveBuffer, sizeof(aReceiveBuffer));
+    }
+    auto myAddress = sockaddr_in{};
+    myAddress.sin_family = AF_INET;
+    myAddress.sin_port = htons(aPort);
+    myAddress.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    EXPECT_THAT(
+        connect(mySocket, reinterpret_cast<const sockaddr*>(&myAddress), sizeof(myAddress)), Eq(0)
+    );
+    return mySocket;
+}
+
+auto readLines(int aSocket, std::size_t aCount) -> std::vector<std::string>
+{
+    auto myText = std::string{};
+    char myChunk[4096];
+    while (static_cast<std::size_t>(std::ranges::count(myText, '\n')) < aCount)
+    {
+        const auto myReceived = recv(aSocket, myChunk, sizeof(myChunk), 0);
+        if (myReceived <= 0)
+        {
+            break;
+        }
+        myText.append(myChunk, static_cast<std::size_t>(myReceived));
+    }
+    auto myLines = std::vector<std::string>{};
+    for (auto myEnd = myText.find('\n'); myEnd != std::string::npos; myEnd = myText.find('\n'))
+    {
+        myLines.push_back(myText.substr(0, myEnd));
+        myText.erase(0, myEnd + 1);
+    }
+    return myLines;
+}
+} // namespace
+
+class ServerTest : public ::testing::Test
+{
+};
+
+TEST_F(ServerTest, ParsesEndpoints)
+{
+    const auto myUnix = Endpoint::parse("unix:/tmp/polya.sock");
+    EXPECT_THAT(myUnix.theKind, Eq(Endpoint::Kind::Unix));
+    EXPECT_THAT(myUnix.thePath, Eq("/tmp/polya.sock"));
+    const auto myTcp = Endpoint::parse("tcp:7070");
+    EXPECT_THAT(myTcp.theKind, Eq(Endpoint::Kind::Tcp));
+    EXPECT_THAT(myTcp.thePort, Eq(7070));
+    EXPECT_THROW(static_cast<void>(Endpoint::parse("tcp:http")), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(Endpoint::parse("udp:53")), std::runtime_error);
+}
+
+TEST_F(ServerTest, AnswersPipelinedRequestsInOrder)
+{
+    auto myEngine = QueryEngine{};
+    auto myServer = Server{myEngine, Endpoint::parse("tcp:0"), 4};
+    auto myRunner = std::jthread{[&myServer] { myServer.run(); }};
+
+    const auto mySocket = connectTo(myServer.port());
+    const auto myRequests = std::string{
+        "id=1 group=symmetric degree=6 colours=3\n"
+        "# skipped\n"
+        "id=2 group=cyclic degree=4 colours=2\n"
+        "id=3 group=cyclic degree=4\n"
+        "id=4 group=cube colours=3 multiplicities=3,2,1\n"};
+    ASSERT_THAT(send(mySocket, myRequests.data(), myRequests.size(), 0), Eq(myRequests.size()));
+    const auto myLines = readLines(mySocket, 4);
+    close(mySocket);
+    myServer.stop();
+
+    ASSERT_THAT(myLines.size(), Eq(4u));
+    EXPECT_THAT(myLines[0], StartsWith("{\"id\":\"1\",\"group\":\"S_6\""));
+    EXPECT_THAT(myLines[1], StartsWith("{\"id\":\"2\","));
+    EXPECT_THAT(myLines[2], StartsWith("{\"line\":4,\"error\":"));
+    EXPECT_THAT(myLines[3], EndsWith("\"colourings\":3}"));
+    EXPECT_THAT(myServer.latencies().count(), Eq(4u));
+}
+
+TEST_F(ServerTest, ReportsLatencies)
+{
+    auto myEngine = QueryEngine{};
+    auto myServer = Server{myEngine, Endpoint::parse("tcp:0"), 1};
+    auto myRunner = std::jthread{[&myServer] { myServer.run(); }};
+
+    const auto mySocket = connectTo(myServer.port());
+    const auto myRequests = std::string{"group=cube colours=2\nstats\n"};
+    ASSERT_THAT(send(mySocket, myRequests.data(), myRequests.size(), 0), Eq(myRequests.size()));
+    const auto myLines = readLines(mySocket, 2);
+    close(mySocket);
+    myServer.stop();
+
+    ASSERT_THAT(myLines.size(), Eq(2u));
+    EXPECT_THAT(myLines[1], StartsWith("{\"latency\":{\"count\":1,"));
+}
+
+TEST_F(ServerTest, ClientsThatDoNotReadOnlyHoldUpThemselves)
+{
+    auto myEngine = QueryEngine{};
+    auto myServer = Server{myEngine, Endpoint::parse("tcp:0"), 2};
+    auto myRunner = std::jthread{[&myServer] { myServer.run(); }};
+
+    // Pipeline far more responses than the socket buffers hold, and never read them
+    const auto myGreedy = connectTo(myServer.port(), 4096);
+    auto myRequests = std::string{};
+    for (auto myIndex = 0; myIndex < 500000; ++myIndex)
+    {
+        myRequests += "group=cube colours=3\n";
+    }
+    auto mySent = 0uz;
+    for (auto myStalls = 0; mySent < myRequests.size() and myStalls < 20;)
+    {
+        const auto myCount = send(
+            myGreedy, myRequests.data() + mySent, myRequests.size() - mySent, MSG_DONTWAIT
+        );
+        if (myCount <= 0)
+        {
+            ++myStalls; // Until the server stops reading
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+            continue;
+        }
+        mySent += static_cast<std::size_t>(myCount);
+        myStalls = 0;
+    }
+
+    const auto mySocket = connectTo(myServer.port());
+    const auto myRequest = std::string{"group=cyclic degree=4 colours=2\n"};
+    ASSERT_THAT(send(mySocket, myRequest.data(), myRequest.size(), 0), Eq(myRequest.size()));
+    EXPECT_THAT(readLines(mySocket, 1), ElementsAre(EndsWith("\"orbits\":6}")));
+    close(mySocket);
+
+    myServer.stop();
+    myRunner.join();
+    close(myGreedy);
+}
+
+TEST_F(ServerTest, RejectsConnectionsPastTheLimit)
+{
+    auto myEngine = QueryEngine{};
+    auto myServer = Server{myEngine, Endpoint::parse("tcp:0"), 1, 1};
+    auto myRunner = std::jthread{[&myServer] { myServer.run(); }};
+    const auto myRequest = std::string{"group=cyclic degree=4 colours=2\n"};
+
+    // Answered, so its reader is running when the next client connects
+    const auto myFirst = connectTo(myServer.port());
+    ASSERT_THAT(send(myFirst, myRequest.data(), myRequest.size(), 0), Eq(myRequest.size()));
+    EXPECT_THAT(readLines(myFirst, 1), ElementsAre(EndsWith("\"orbits\":6}")));
+
+    const auto mySecond = connectTo(myServer.port());
+    EXPECT_THAT(readLines(mySecond, 2), ElementsAre("{\"error\":\"Too many connections\"}"));
+    close(mySecond);
+
+    // The slot is free again once the first reader sees its client close
+    close(myFirst);
+    auto myLines = std::vector<std::string>{};
+    for (auto myAttempt = 0; myAttempt < 50 and myLines.empty(); ++myAttempt)
+    {
+        const auto myThird = connectTo(myServer.port());
+        send(myThird, myRequest.data(), myRequest.size(), MSG_NOSIGNAL);
+        myLines = readLines(myThird, 1);
+        close(myThird);
+        if (not myLines.empty() and myLines.front().starts_with("{\"error\""))
+        {
+            myLines.clear();
+            std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        }
+    }
+    EXPECT_THAT(myLines, ElementsAre(EndsWith("\"orbits\":6}")));
+    myServer.stop();
+}
+
+TEST_F(ServerTest, RemovesOnlyItsOwnSocketFile)
+{
+    const auto myPath = std::filesystem::path{::testing::TempDir()} / "polya-server-test";
+    std::filesystem::remove(myPath);
+    auto myEngine = QueryEngine{};
+
+    // A file that is not a socket is never replaced
+    std::ofstream{myPath} << "data";
+    EXPECT_THROW(
+        (Server{myEngine, Endpoint::parse("unix:" + myPath.string()), 1}), std::runtime_error
+    );
+    EXPECT_THAT(std::filesystem::is_regular_file(myPath), IsTrue());
+    std::filesystem::remove(myPath);
+
+    {
+        const auto myServer = Server{myEngine, Endpoint::parse("unix:" + myPath.string()), 1};
+        EXPECT_THAT(std::filesystem::is_socket(myPath), IsTrue());
+    }
+    EXPECT_THAT(std::filesystem::exists(myPath), IsFalse());
+}
+} // namespace polya::test
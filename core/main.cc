@@ -1,35 +1,155 @@
-#include "core/api/Polya.hh"
-#include "core/util/Exception.hh"
+#include "core/driver/QueryEngine.hh"
+#include "core/driver/Server.hh"
+#include "core/util/Stats.hh"
 
+#include <charconv>
+#include <csignal>
+#include <cstdint>
+#include <fstream>
 #include <iostream>
-#include <vector>
+#include <optional>
+#include <string_view>
+#include <thread>
 
 using namespace polya;
 
-auto main() -> int
+namespace
 {
-    const auto myOrbitCount = orbits::countOrbits(groups::tetrahedron(), orbits::ColourCount{3});
-    const auto myCycleIndex = cycleIndexPolynomial(
-        groups::tetrahedron(),
-        std::vector{
-            Polynomial::VariableName{"u"}, Polynomial::VariableName{"v"},
-            Polynomial::VariableName{"w"}, Polynomial::VariableName{"x"}}
-    );
-    const auto myPolyaPolynomial = evaluateColours(
-        myCycleIndex, orbits::ColourCount{3},
-        std::vector{
-            Polynomial::VariableName{"r"}, Polynomial::VariableName{"g"},
-            Polynomial::VariableName{"b"}}
-    );
-
-    std::cout << "Orbits: " << myOrbitCount.get() << '\n'
-              << "Cycle index polynomial: " << myCycleIndex.get().toString() << '\n'
-              << "Polya polynomial with three colours: " << myPolyaPolynomial.toString() << '\n';
-
-    ensure(
-        myOrbitCount == evaluateUniform(myCycleIndex, orbits::ColourCount{3}),
-        "Orbit counting theorem should match cycle index polynomial evaluated at a constant"
-    );
-
-    return 0;
-}
\ No newline at end of file
+auto usage(const char* aProgram) -> int
+{
+    std::cerr << "Usage: " << aProgram << " [queries] [--memory-budget <MiB>] [--stats]\n"
+              << "       " << aProgram
+              << " --serve unix:<path>|tcp:<port> [--workers <n>] [--memory-budget <MiB>]"
+                 " [--stats]\n";
+    return 2;
+}
+
+// Serves until SIGINT or SIGTERM, which are handled by a waiting thread rather than a signal
+// handler so that stopping the server may lock
+auto serve(driver::QueryEngine& anEngine, std::string_view anEndpoint, std::size_t aWorkers)
+    -> void
+{
+    auto mySignals = sigset_t{};
+    sigemptyset(&mySignals);
+    sigaddset(&mySignals, SIGINT);
+    sigaddset(&mySignals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &mySignals, nullptr); // Inherited by the server's threads
+
+    auto myServer = driver::Server{anEngine, driver::Endpoint::parse(anEndpoint), aWorkers};
+    std::cerr << "Serving on " << anEndpoint;
+    if (myServer.port() != 0)
+    {
+        std::cerr << " (port " << myServer.port() << ')';
+    }
+    std::cerr << " with " << aWorkers << " workers\n";
+
+    auto mySignalWaiter = std::jthread{[&myServer, &mySignals]
+                                       {
+                                           auto mySignal = 0;
+                                           sigwait(&mySignals, &mySignal);
+                                           myServer.stop();
+                                       }};
+    myServer.run();
+    std::cerr << "Latency: " << myServer.latencies().toJson() << '\n';
+}
+} // namespace
+
+// Answers a batch of queries, one per line, from a file or stdin and writes line-delimited JSON
+// to stdout, or serves the same protocol on a socket, e.g.
+//
+//   echo "group=cube colours=3 multiplicities=3,2,1" | main
+//   main queries.txt --stats
+//   main --serve unix:/tmp/polya.sock --workers 8
+//
+// See core/driver/Query.hh for the query format. --memory-budget rejects queries estimated to need
+// more memory, and --stats prints the library counters to stderr.
+auto main(int argc, char** argv) -> int
+{
+    auto myPath = std::string_view{};
+    auto myEndpoint = std::optional<std::string_view>{};
+    auto myWorkers = std::size_t{std::max(std::thread::hardware_concurrency(), 1u)};
+    auto myMemoryBudget = std::optional<std::uint64_t>{};
+    auto myStats = false;
+    for (auto myIndex = 1; myIndex < argc; ++myIndex)
+    {
+        const auto myArgument = std::string_view{argv[myIndex]};
+        if (myArgument == "--stats")
+        {
+            myStats = true;
+        }
+        else if (myArgument == "--serve" and myIndex + 1 < argc)
+        {
+            myEndpoint = argv[++myIndex];
+        }
+        else if (myArgument == "--workers" and myIndex + 1 < argc)
+        {
+            const auto myValue = std::string_view{argv[++myIndex]};
+            const auto [myEnd, myError] =
+                std::from_chars(myValue.data(), myValue.data() + myValue.size(), myWorkers);
+            if (myError != std::errc{} or myEnd != myValue.data() + myValue.size()
+                or myWorkers == 0)
+            {
+                return usage(argv[0]);
+            }
+        }
+        else if (myArgument == "--memory-budget" and myIndex + 1 < argc)
+        {
+            const auto myValue = std::string_view{argv[++myIndex]};
+            auto myMebibytes = std::uint64_t{0};
+            const auto [myEnd, myError] =
+                std::from_chars(myValue.data(), myValue.data() + myValue.size(), myMebibytes);
+            if (myError != std::errc{} or myEnd != myValue.data() + myValue.size()
+                or myMebibytes == 0 or myMebibytes > (std::uint64_t{1} << 40))
+            {
+                return usage(argv[0]);
+            }
+            myMemoryBudget = myMebibytes << 20;
+        }
+        else if (myPath.empty() and not myArgument.starts_with("--"))
+        {
+            myPath = myArgument;
+        }
+        else
+        {
+            return usage(argv[0]);
+        }
+    }
+    if (myEndpoint and not myPath.empty())
+    {
+        return usage(argv[0]);
+    }
+
+    std::ios::sync_with_stdio(false);
+    auto myEngine = driver::QueryEngine{myMemoryBudget};
+    auto mySummary = driver::QueryEngine::Summary{};
+    if (myEndpoint)
+    {
+        serve(myEngine, *myEndpoint, myWorkers);
+    }
+    else if (myPath.empty())
+    {
+        mySummary = myEngine.run(std::cin, std::cout);
+    }
+    else
+    {
+        auto myFile = std::ifstream{std::string{myPath}};
+        if (not myFile)
+        {
+            std::cerr << "Could not open " << myPath << '\n';
+            return 2;
+        }
+        mySummary = myEngine.run(myFile, std::cout);
+    }
+    std::cout.flush();
+
+    if (myStats)
+    {
+        if (not myEndpoint)
+        {
+            std::cerr << "Answered " << mySummary.theAnswered << ", failed "
+                      << mySummary.theFailed << '\n';
+        }
+        std::cerr << stats::snapshot();
+    }
+    return mySummary.theFailed == 0 ? 0 : 1;
+}
@@ -0,0 +1,512 @@
+#include "core/polya-enumeration/cycle-index/CycleIndexAlgebra.hh"
+
+#include "core/util/Exception.hh"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace polya
+{
+using Degree = CycleIndexPolynomial::Degree;
+using Length = CycleType::Length;
+using Multiplicity = CycleType::Multiplicity;
+using Part = CycleType::Part;
+
+namespace
+{
+// anInteger in the coefficient ring of aZero
+auto integer(const Rational&, std::uint64_t anInteger) -> Rational
+{
+    return Rational{static_cast<std::int64_t>(anInteger)};
+}
+
+auto integer(const Modular& aZero, std::uint64_t anInteger) -> Modular
+{
+    return Modular{static_cast<std::int64_t>(anInteger), aZero.modulus()};
+}
+
+// Appends every partition of aRest into parts of at most aLargest to aParts, adding each with
+// aCoefficient divided by the z_lambda of its new parts
+template <typename Coefficient>
+auto addPartitions(
+    std::vector<Part>& aParts, std::uint32_t aRest, std::uint32_t aLargest,
+    const Coefficient& aCoefficient, BasicCycleIndexPolynomial<Coefficient>& aResult
+) -> void
+{
+    if (aRest == 0)
+    {
+        aResult.set(CycleType{aParts}, aCoefficient);
+        return;
+    }
+    for (auto myLength = std::min(aRest, aLargest); myLength > 0; --myLength)
+    {
+        auto myCoefficient = aCoefficient;
+        for (auto myCount = 1u; myCount * myLength <= aRest; ++myCount)
+        {
+            // z_lambda = prod_k k^(m_k) m_k! gains a factor of k m for the m-th cycle of length k
+            myCoefficient /= integer(aCoefficient, std::uint64_t{myLength} * myCount);
+            aParts.push_back(Part{Length{myLength}, Multiplicity{myCount}});
+            addPartitions(aParts, aRest - myCount * myLength, myLength - 1, myCoefficient, aResult);
+            aParts.pop_back();
+        }
+    }
+}
+
+// Checked narrowing for the sizes of induced actions, whose cycle lengths and multiplicities are
+// then bounded by their degree
+auto inducedDegree(std::uint64_t aDegree) -> Degree
+{
+    ensure(
+        aDegree <= std::numeric_limits<std::uint32_t>::max(),
+        "Expected an induced action on at most {} points, but it has {}",
+        std::numeric_limits<std::uint32_t>::max(), aDegree
+    );
+    return Degree{aDegree};
+}
+
+auto part(std::uint64_t aLength, std::uint64_t aCount) -> Part
+{
+    return Part{
+        Length{static_cast<std::uint32_t>(aLength)},
+        Multiplicity{static_cast<std::uint32_t>(aCount)}};
+}
+
+auto inducedCycleType(const CycleType& aCycleType, InducedAction anAction) -> CycleType
+{
+    const auto& myBase = aCycleType.parts();
+    // Each pair of distinct cycles is counted once for edges and twice for ordered pairs
+    const auto myOrientations = anAction == InducedAction::Edges ? 1uz : 2uz;
+    auto myParts = std::vector<Part>{};
+    for (auto myIndex = 0uz; myIndex < myBase.size(); ++myIndex)
+    {
+        const auto myLength = std::uint64_t{myBase[myIndex].theLength.get()};
+        const auto myCount = std::uint64_t{myBase[myIndex].theMultiplicity.get()};
+
+        // Pairs within one cycle of length l
+        switch (anAction)
+        {
+            case InducedAction::Edges:
+                // The pairs at distance l / 2 of an even cycle return after l / 2 steps
+                myParts.push_back(part(myLength, myCount * ((myLength - 1) / 2)));
+                if (myLength % 2 == 0)
+                {
+                    myParts.push_back(part(myLength / 2, myCount));
+                }
+                break;
+            case InducedAction::DirectedEdges:
+                myParts.push_back(part(myLength, myCount * (myLength - 1)));
+                break;
+            case InducedAction::OrderedPairs:
+                myParts.push_back(part(myLength, myCount * myLength));
+                break;
+        }
+
+        // Pairs between two cycles of the same length l give l cycles of length l
+        myParts.push_back(
+            part(myLength, myLength * myCount * (myCount - 1) / 2 * myOrientations)
+        );
+
+        // And between cycles of lengths a and b, gcd(a, b) cycles of length lcm(a, b)
+        for (auto myOther = myIndex + 1; myOther < myBase.size(); ++myOther)
+        {
+            const auto myOtherLength = std::uint64_t{myBase[myOther].theLength.get()};
+            const auto myGcd = std::gcd(myLength, myOtherLength);
+            myParts.push_back(part(
+                myLength / myGcd * myOtherLength,
+                myCount * myBase[myOther].theMultiplicity.get() * myGcd * myOrientations
+            ));
+        }
+    }
+    return CycleType{std::move(myParts)};
+}
+
+// The divisors of the order of a permutation of this cycle type, in increasing order
+auto orderDivisors(const CycleType& aCycleType) -> std::vector<std::uint64_t>
+{
+    // Prime factors of the order are those of the cycle lengths, at their highest powers
+    auto myFactors = std::map<std::uint64_t, std::uint32_t>{};
+    for (const auto& myPart : aCycleType.parts())
+    {
+        auto myLength = std::uint64_t{myPart.theLength.get()};
+        // Composite divisors never divide what is left once their prime factors are removed
+        for (auto myPrime = std::uint64_t{2}; myPrime <= myLength; ++myPrime)
+        {
+            auto myPower = 0u;
+            for (; myLength % myPrime == 0; myLength /= myPrime)
+            {
+                ++myPower;
+            }
+            if (myPower > 0)
+            {
+                myFactors[myPrime] = std::max(myFactors[myPrime], myPower);
+            }
+        }
+    }
+
+    auto myDivisors = std::vector<std::uint64_t>{1};
+    for (const auto& [myPrime, myPower] : myFactors)
+    {
+        const auto myCount = myDivisors.size();
+        auto myPrimePower = std::uint64_t{1};
+        for (auto myExponent = 0u; myExponent < myPower; ++myExponent)
+        {
+            ensure(
+                not __builtin_mul_overflow(myPrimePower, myPrime, &myPrimePower),
+                "Expected the order of a permutation to fit in 64 bits"
+            );
+            for (auto myIndex = 0uz; myIndex < myCount; ++myIndex)
+            {
+                auto myDivisor = std::uint64_t{0};
+                ensure(
+                    not __builtin_mul_overflow(myDivisors[myIndex], myPrimePower, &myDivisor),
+                    "Expected the order of a permutation to fit in 64 bits"
+                );
+                myDivisors.push_back(myDivisor);
+            }
+        }
+    }
+    std::ranges::sort(myDivisors);
+    return myDivisors;
+}
+
+// C(n, k) for n up to aDegree and k up to aSubsetSize, saturating
+auto binomials(std::size_t aDegree, std::size_t aSubsetSize)
+    -> std::vector<std::vector<std::uint64_t>>
+{
+    auto myTable = std::vector<std::vector<std::uint64_t>>(
+        aDegree + 1, std::vector<std::uint64_t>(aSubsetSize + 1, 0)
+    );
+    for (auto myN = 0uz; myN <= aDegree; ++myN)
+    {
+        myTable[myN][0] = 1;
+        for (auto myK = 1uz; myK <= std::min(myN, aSubsetSize); ++myK)
+        {
+            if (__builtin_add_overflow(
+                    myTable[myN - 1][myK - 1], myTable[myN - 1][myK], &myTable[myN][myK]
+                ))
+            {
+                myTable[myN][myK] = std::numeric_limits<std::uint64_t>::max();
+            }
+        }
+    }
+    return myTable;
+}
+
+// The aSubsetSize-subsets fixed by sigma^aPower, i.e. the coefficient of t^aSubsetSize in the
+// product over the cycles of sigma^aPower of (1 + t^length). A cycle of length l splits into
+// gcd(l, d) cycles of length l / gcd(l, d) in sigma^d.
+auto fixedSubsets(
+    const CycleType& aCycleType, std::uint64_t aPower, std::size_t aSubsetSize,
+    const std::vector<std::vector<std::uint64_t>>& aBinomials
+) -> std::uint64_t
+{
+    auto myProduct = std::vector<std::uint64_t>(aSubsetSize + 1, 0);
+    myProduct[0] = 1;
+    for (const auto& myPart : aCycleType.parts())
+    {
+        const auto myGcd = std::gcd(std::uint64_t{myPart.theLength.get()}, aPower);
+        const auto myLength = myPart.theLength.get() / myGcd;
+        const auto myCycles = myPart.theMultiplicity.get() * myGcd;
+        // Downwards, so each coefficient still holds the previous product when it is read
+        for (auto myDegree = aSubsetSize; myDegree > 0; --myDegree)
+        {
+            for (auto myChosen = 1uz; myChosen <= std::min<std::uint64_t>(myCycles, aSubsetSize)
+                                      and myChosen * myLength <= myDegree;
+                 ++myChosen)
+            {
+                myProduct[myDegree] += aBinomials[myCycles][myChosen]
+                                       * myProduct[myDegree - myChosen * myLength];
+            }
+        }
+    }
+    return myProduct[aSubsetSize];
+}
+
+auto subsetCycleType(
+    const CycleType& aCycleType, std::size_t aSubsetSize,
+    const std::vector<std::vector<std::uint64_t>>& aBinomials
+) -> CycleType
+{
+    // The subsets on induced cycles of length exactly d are those fixed by sigma^d less those on
+    // cycles of the proper divisors of d
+    const auto myDivisors = orderDivisors(aCycleType);
+    auto mySubsets = std::vector<std::uint64_t>(myDivisors.size(), 0);
+    auto myParts = std::vector<Part>{};
+    for (auto myIndex = 0uz; myIndex < myDivisors.size(); ++myIndex)
+    {
+        mySubsets[myIndex] = fixedSubsets(aCycleType, myDivisors[myIndex], aSubsetSize, aBinomials);
+        for (auto myDivisor = 0uz; myDivisor < myIndex; ++myDivisor)
+        {
+            if (myDivisors[myIndex] % myDivisors[myDivisor] == 0)
+            {
+                mySubsets[myIndex] -= mySubsets[myDivisor];
+            }
+        }
+        myParts.push_back(part(myDivisors[myIndex], mySubsets[myIndex] / myDivisors[myIndex]));
+    }
+    return CycleType{std::move(myParts)};
+}
+
+auto cartesianCycleType(const CycleType& aFirst, const CycleType& aSecond) -> CycleType
+{
+    auto myParts = std::vector<Part>{};
+    for (const auto& myFirst : aFirst.parts())
+    {
+        for (const auto& mySecond : aSecond.parts())
+        {
+            const auto myLength = std::uint64_t{myFirst.theLength.get()};
+            const auto myGcd = std::gcd(myLength, std::uint64_t{mySecond.theLength.get()});
+            myParts.push_back(part(
+                myLength / myGcd * mySecond.theLength.get(),
+                std::uint64_t{myFirst.theMultiplicity.get()} * mySecond.theMultiplicity.get()
+                    * myGcd
+            ));
+        }
+    }
+    return CycleType{std::move(myParts)};
+}
+
+// Sparse product of two sums of cycle types, with cycle types multiplied as monomials
+template <typename Terms>
+auto multiply(const Terms& aFirst, const Terms& aSecond) -> Terms
+{
+    auto myResult = Terms{};
+    for (const auto& [myFirstType, myFirstCoefficient] : aFirst)
+    {
+        for (const auto& [mySecondType, mySecondCoefficient] : aSecond)
+        {
+            auto [myTerm, myInserted] = myResult.try_emplace(
+                myFirstType * mySecondType, myFirstCoefficient * mySecondCoefficient
+            );
+            if (not myInserted)
+            {
+                myTerm->second += myFirstCoefficient * mySecondCoefficient;
+            }
+        }
+    }
+    return myResult;
+}
+
+// Z(p_k, p_2k, ...), i.e. every cycle length multiplied by aFactor
+template <typename Terms>
+auto scaled(const Terms& aTerms, std::uint32_t aFactor) -> Terms
+{
+    auto myResult = Terms{};
+    for (const auto& [myCycleType, myCoefficient] : aTerms)
+    {
+        auto myParts = myCycleType.parts();
+        for (auto& myPart : myParts)
+        {
+            myPart.theLength = Length{myPart.theLength.get() * aFactor};
+        }
+        myResult.emplace(CycleType{std::move(myParts)}, myCoefficient);
+    }
+    return myResult;
+}
+
+// The powers Z_B(p_k, p_2k, ...)^m of an inner cycle index, each computed once and shared by
+// every outer term with m cycles of length k
+template <typename Terms>
+class ScaledPowers
+{
+public:
+    explicit ScaledPowers(const Terms& anInner) : theInner{anInner}
+    {
+    }
+
+    auto power(std::uint32_t aLength, std::uint32_t anExponent) -> const Terms&
+    {
+        auto& myPowers = thePowers[aLength];
+        if (myPowers.empty())
+        {
+            myPowers.push_back(scaled(theInner, aLength));
+        }
+        while (myPowers.size() < anExponent)
+        {
+            myPowers.push_back(multiply(myPowers.back(), myPowers.front()));
+        }
+        return myPowers[anExponent - 1];
+    }
+
+private:
+    const Terms& theInner;
+    std::map<std::uint32_t, std::vector<Terms>> thePowers; // m-th at m - 1
+};
+
+// The partitions of aDegree, each with 1 / z_lambda in the ring of aZero
+template <typename Coefficient>
+auto partitionCycleIndex(Degree aDegree, const Coefficient& aZero)
+    -> BasicCycleIndexPolynomial<Coefficient>
+{
+    ensure(
+        aDegree.get() <= std::numeric_limits<std::uint32_t>::max(),
+        "Expected a degree of at most {}, but received {}",
+        std::numeric_limits<std::uint32_t>::max(), aDegree.get()
+    );
+    const auto myDegree = static_cast<std::uint32_t>(aDegree.get());
+    auto myResult = BasicCycleIndexPolynomial<Coefficient>{aDegree, std::nullopt, aZero};
+    auto myParts = std::vector<Part>{};
+    addPartitions(myParts, myDegree, myDegree, integer(aZero, 1), myResult);
+    return myResult;
+}
+} // namespace
+
+auto symmetricCycleIndex(Degree aDegree) -> CycleIndexPolynomial
+{
+    return partitionCycleIndex(aDegree, Rational{0});
+}
+
+auto symmetricCycleIndex(Degree aDegree, Modular::Modulus aModulus) -> ModularCycleIndex
+{
+    // Every z_lambda is a product of integers up to n, which are then invertible mod a prime p > n
+    ensure(
+        aModulus.get() > aDegree.get(), "Expected a modulus above the degree {}, but received {}",
+        aDegree.get(), aModulus.get()
+    );
+    return partitionCycleIndex(aDegree, Modular{0, aModulus});
+}
+
+template <typename Coefficient>
+auto inducedCycleIndex(
+    const BasicCycleIndexPolynomial<Coefficient>& aCycleIndex, InducedAction anAction
+) -> BasicCycleIndexPolynomial<Coefficient>
+{
+    const auto myDegree = std::uint64_t{aCycleIndex.degree().get()};
+    const auto myPairs = anAction == InducedAction::Edges ? myDegree * (myDegree - 1) / 2
+                         : anAction == InducedAction::DirectedEdges ? myDegree * (myDegree - 1)
+                                                                    : myDegree * myDegree;
+    auto myResult = BasicCycleIndexPolynomial<Coefficient>{
+        inducedDegree(myPairs), std::nullopt, aCycleIndex.zero()};
+    for (const auto& [myCycleType, myCoefficient] : aCycleIndex.terms())
+    {
+        myResult.add(inducedCycleType(myCycleType, anAction), myCoefficient);
+    }
+    return myResult;
+}
+
+template <typename Coefficient>
+auto subsetCycleIndex(
+    const BasicCycleIndexPolynomial<Coefficient>& aCycleIndex, std::uint32_t aSubsetSize
+) -> BasicCycleIndexPolynomial<Coefficient>
+{
+    const auto myDegree = aCycleIndex.degree().get();
+    ensure(
+        aSubsetSize <= myDegree, "Expected subsets of at most {} points, but received {}",
+        myDegree, aSubsetSize
+    );
+    // Complements are permuted alike, so the smaller of k and n - k is used. Every count is then
+    // at most C(n, k), which fits in 32 bits, so products of two of them cannot overflow.
+    const auto mySubsetSize = std::min<std::size_t>(aSubsetSize, myDegree - aSubsetSize);
+    const auto myBinomials = binomials(myDegree, mySubsetSize);
+    auto myResult = BasicCycleIndexPolynomial<Coefficient>{
+        inducedDegree(myBinomials[myDegree][mySubsetSize]), std::nullopt, aCycleIndex.zero()};
+    for (const auto& [myCycleType, myCoefficient] : aCycleIndex.terms())
+    {
+        myResult.add(subsetCycleType(myCycleType, mySubsetSize, myBinomials), myCoefficient);
+    }
+    return myResult;
+}
+
+template <typename Coefficient>
+auto directProduct(
+    const BasicCycleIndexPolynomial<Coefficient>& aFirst,
+    const BasicCycleIndexPolynomial<Coefficient>& aSecond
+) -> BasicCycleIndexPolynomial<Coefficient>
+{
+    auto myResult = BasicCycleIndexPolynomial<Coefficient>{
+        inducedDegree(std::uint64_t{aFirst.degree().get()} + aSecond.degree().get()),
+        std::nullopt, aFirst.zero()};
+    for (const auto& [myCycleType, myCoefficient] : multiply(aFirst.terms(), aSecond.terms()))
+    {
+        myResult.add(myCycleType, myCoefficient);
+    }
+    return myResult;
+}
+
+template <typename Coefficient>
+auto cartesianProduct(
+    const BasicCycleIndexPolynomial<Coefficient>& aFirst,
+    const BasicCycleIndexPolynomial<Coefficient>& aSecond
+) -> BasicCycleIndexPolynomial<Coefficient>
+{
+    auto myResult = BasicCycleIndexPolynomial<Coefficient>{
+        inducedDegree(std::uint64_t{aFirst.degree().get()} * aSecond.degree().get()),
+        std::nullopt, aFirst.zero()};
+    for (const auto& [myFirstType, myFirstCoefficient] : aFirst.terms())
+    {
+        for (const auto& [mySecondType, mySecondCoefficient] : aSecond.terms())
+        {
+            myResult.add(
+                cartesianCycleType(myFirstType, mySecondType),
+                myFirstCoefficient * mySecondCoefficient
+            );
+        }
+    }
+    return myResult;
+}
+
+template <typename Coefficient>
+auto compose(
+    const BasicCycleIndexPolynomial<Coefficient>& anOuter,
+    const BasicCycleIndexPolynomial<Coefficient>& anInner
+) -> BasicCycleIndexPolynomial<Coefficient>
+{
+    using Terms = typename BasicCycleIndexPolynomial<Coefficient>::Terms;
+    auto myResult = BasicCycleIndexPolynomial<Coefficient>{
+        inducedDegree(std::uint64_t{anOuter.degree().get()} * anInner.degree().get()),
+        std::nullopt, anOuter.zero()};
+    auto myPowers = ScaledPowers{anInner.terms()};
+    for (const auto& [myCycleType, myCoefficient] : anOuter.terms())
+    {
+        auto myProduct = Terms{{CycleType{}, integer(anOuter.zero(), 1)}};
+        for (const auto& myPart : myCycleType.parts())
+        {
+            myProduct = multiply(
+                myProduct, myPowers.power(myPart.theLength.get(), myPart.theMultiplicity.get())
+            );
+        }
+        for (const auto& [myProductType, myProductCoefficient] : myProduct)
+        {
+            myResult.add(myProductType, myCoefficient * myProductCoefficient);
+        }
+    }
+    return myResult;
+}
+
+template <typename Coefficient>
+auto wreathProduct(
+    const BasicCycleIndexPolynomial<Coefficient>& anOuter,
+    const BasicCycleIndexPolynomial<Coefficient>& anInner
+) -> BasicCycleIndexPolynomial<Coefficient>
+{
+    // A cycle of length k of the outer permutation carries k copies of Y round, and the product
+    // of the inner permutations along it acts on them with cycles k times as long
+    return compose(anOuter, anInner);
+}
+
+template auto inducedCycleIndex(const CycleIndexPolynomial&, InducedAction)
+    -> CycleIndexPolynomial;
+template auto inducedCycleIndex(const ModularCycleIndex&, InducedAction) -> ModularCycleIndex;
+template auto subsetCycleIndex(const CycleIndexPolynomial&, std::uint32_t) -> CycleIndexPolynomial;
+template auto subsetCycleIndex(const ModularCycleIndex&, std::uint32_t) -> ModularCycleIndex;
+template auto directProduct(const CycleIndexPolynomial&, const CycleIndexPolynomial&)
+    -> CycleIndexPolynomial;
+template auto directProduct(const ModularCycleIndex&, const ModularCycleIndex&)
+    -> ModularCycleIndex;
+template auto cartesianProduct(const CycleIndexPolynomial&, const CycleIndexPolynomial&)
+    -> CycleIndexPolynomial;
+template auto cartesianProduct(const ModularCycleIndex&, const ModularCycleIndex&)
+    -> ModularCycleIndex;
+template auto compose(const CycleIndexPolynomial&, const CycleIndexPolynomial&)
+    -> CycleIndexPolynomial;
+template auto compose(const ModularCycleIndex&, const ModularCycleIndex&) -> ModularCycleIndex;
+template auto wreathProduct(const CycleIndexPolynomial&, const CycleIndexPolynomial&)
+    -> CycleIndexPolynomial;
+template auto wreathProduct(const ModularCycleIndex&, const ModularCycleIndex&)
+    -> ModularCycleIndex;
+} // namespace polya
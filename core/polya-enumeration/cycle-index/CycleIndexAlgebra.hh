@@ -0,0 +1,80 @@
+#pragma once
+
+#include "core/polya-enumeration/cycle-index/CycleIndexPolynomial.hh"
+
+#include <cstdint>
+
+namespace polya
+{
+// Cycle indices built from cycle types alone, without generating the permutation groups. The
+// constructions take exact Rational coefficients, whose group orders must fit in 64 bits, or
+// residues modulo a prime, which have no such limit.
+
+// Z(S_n) as the sum over the partitions of n of p_lambda / z_lambda, where
+// z_lambda = prod_k k^(m_k) m_k!. Throws if some z_lambda does not fit, i.e. for n > 20.
+auto symmetricCycleIndex(CycleIndexPolynomial::Degree aDegree) -> CycleIndexPolynomial;
+
+// Z(S_n) modulo a prime p > n, e.g. for counting graphs on 60 vertices from its 966467 terms.
+// Every z_lambda divides n!, so it is invertible mod p. Throws if p <= n.
+auto symmetricCycleIndex(CycleIndexPolynomial::Degree aDegree, Modular::Modulus aModulus)
+    -> ModularCycleIndex;
+
+// Actions induced by a group acting on X
+enum class InducedAction
+{
+    Edges,         // Unordered pairs of distinct points, e.g. the edges of simple graphs
+    DirectedEdges, // Ordered pairs of distinct points, e.g. the arcs of loopless digraphs
+    OrderedPairs,  // All of X x X, e.g. binary relations
+};
+
+// The cycle index of the induced action. A cycle of length a and one of length b give gcd(a, b)
+// cycles of length lcm(a, b) on the pairs between them, so each term is mapped in time quadratic
+// in its number of distinct cycle lengths.
+template <typename Coefficient>
+auto inducedCycleIndex(
+    const BasicCycleIndexPolynomial<Coefficient>& aCycleIndex, InducedAction anAction
+) -> BasicCycleIndexPolynomial<Coefficient>;
+
+// The cycle index of the action on the aSubsetSize-subsets of X. The subsets fixed by each power
+// sigma^d of a permutation are unions of cycles of sigma^d, and the induced cycles of length
+// exactly d are recovered from those counts over the divisors d of the order of sigma.
+template <typename Coefficient>
+auto subsetCycleIndex(
+    const BasicCycleIndexPolynomial<Coefficient>& aCycleIndex, std::uint32_t aSubsetSize
+) -> BasicCycleIndexPolynomial<Coefficient>;
+
+// Products of groups acting on disjoint sets X and Y, from the cycle indices of the factors. The
+// groups are never built, so the cost follows the number of terms rather than |A| |B|. Modular
+// factors must share their modulus.
+
+// A x B acting on X + Y, each factor on its own points: Z_A Z_B
+template <typename Coefficient>
+auto directProduct(
+    const BasicCycleIndexPolynomial<Coefficient>& aFirst,
+    const BasicCycleIndexPolynomial<Coefficient>& aSecond
+) -> BasicCycleIndexPolynomial<Coefficient>;
+
+// A x B acting on X x Y by (a, b)(x, y) = (a x, b y). Cycles of lengths a and b give gcd(a, b)
+// cycles of length lcm(a, b).
+template <typename Coefficient>
+auto cartesianProduct(
+    const BasicCycleIndexPolynomial<Coefficient>& aFirst,
+    const BasicCycleIndexPolynomial<Coefficient>& aSecond
+) -> BasicCycleIndexPolynomial<Coefficient>;
+
+// The plethysm Z_A[Z_B]: Z_A with each p_k replaced by Z_B(p_k, p_2k, ...), on |X| |Y| points.
+// Each power of each scaled Z_B is multiplied out once and reused across the terms of Z_A.
+template <typename Coefficient>
+auto compose(
+    const BasicCycleIndexPolynomial<Coefficient>& anOuter,
+    const BasicCycleIndexPolynomial<Coefficient>& anInner
+) -> BasicCycleIndexPolynomial<Coefficient>;
+
+// B wr A acting on X x Y: A permutes the |X| copies of Y, each of which B permutes independently,
+// e.g. a cube whose faces carry rotatable grids. Its cycle index is compose(Z_A, Z_B).
+template <typename Coefficient>
+auto wreathProduct(
+    const BasicCycleIndexPolynomial<Coefficient>& anOuter,
+    const BasicCycleIndexPolynomial<Coefficient>& anInner
+) -> BasicCycleIndexPolynomial<Coefficient>;
+} // namespace polya
@@ -0,0 +1,181 @@
+#include "core/polya-enumeration/cycle-index/CycleIndexPolynomial.hh"
+
+#include "core/util/Exception.hh"
+#include "core/util/Stats.hh"
+
+#include <range/v3/all.hpp>
+#include <string>
+#include <utility>
+
+namespace polya
+{
+namespace views = ranges::views;
+using VariableName = Polynomial::VariableName;
+using Degree = CycleIndexPolynomial::Degree;
+
+namespace
+{
+auto defaultVariableNames(Degree aDegree) -> std::vector<VariableName>
+{
+    return views::iota(1uz, aDegree.get() + 1)
+           | views::transform([](const auto& aValue)
+                              { return VariableName{"x_" + std::to_string(aValue)}; })
+           | ranges::to<std::vector<VariableName>>();
+}
+} // namespace
+
+template <typename Coefficient>
+BasicCycleIndexPolynomial<Coefficient>::BasicCycleIndexPolynomial(
+    Degree aDegree, std::optional<std::vector<VariableName>> aVariableNames, Coefficient aZero
+)
+    : theDegree{aDegree},
+      theVariableNames{
+          aVariableNames ? std::move(*aVariableNames) : defaultVariableNames(aDegree)},
+      theZero{std::move(aZero)}
+{
+    ensure(
+        theVariableNames.size() == theDegree.get(),
+        "Expected the number of variable names ({}) to match the degree ({})",
+        theVariableNames.size(), theDegree.get()
+    );
+}
+
+template <typename Coefficient>
+auto BasicCycleIndexPolynomial<Coefficient>::degree() const -> Degree
+{
+    return theDegree;
+}
+
+template <typename Coefficient>
+auto BasicCycleIndexPolynomial<Coefficient>::variables() const -> const std::vector<VariableName>&
+{
+    return theVariableNames;
+}
+
+template <typename Coefficient>
+auto BasicCycleIndexPolynomial<Coefficient>::zero() const -> const Coefficient&
+{
+    return theZero;
+}
+
+template <typename Coefficient>
+auto BasicCycleIndexPolynomial<Coefficient>::coefficient(const CycleType& aCycleType) const
+    -> Coefficient
+{
+    const auto myTerm = theCoefficientMap.find(aCycleType);
+    return myTerm != theCoefficientMap.end() ? myTerm->second : theZero;
+}
+
+template <typename Coefficient>
+auto BasicCycleIndexPolynomial<Coefficient>::set(
+    const CycleType& aCycleType, const Coefficient& aCoefficient
+) -> void
+{
+    ensure(
+        aCycleType.degree().get() == theDegree.get(),
+        "Expected cycle type of degree {}, but received degree {}", theDegree.get(),
+        aCycleType.degree().get()
+    );
+    if (aCoefficient == theZero)
+    {
+        theCoefficientMap.erase(aCycleType);
+        return;
+    }
+    theCoefficientMap.insert_or_assign(aCycleType, aCoefficient);
+    stats::count(stats::Counter::MapInsertions);
+}
+
+template <typename Coefficient>
+auto BasicCycleIndexPolynomial<Coefficient>::add(
+    const CycleType& aCycleType, const Coefficient& aCoefficient
+) -> void
+{
+    set(aCycleType, coefficient(aCycleType) + aCoefficient);
+}
+
+template <typename Coefficient>
+auto BasicCycleIndexPolynomial<Coefficient>::isZero() const -> bool
+{
+    return theCoefficientMap.empty();
+}
+
+template <typename Coefficient>
+auto BasicCycleIndexPolynomial<Coefficient>::terms() const -> const Terms&
+{
+    return theCoefficientMap;
+}
+
+template <typename Coefficient>
+auto BasicCycleIndexPolynomial<Coefficient>::toPolynomial() const -> Polynomial
+    requires std::same_as<Coefficient, Rational>
+{
+    auto myPolynomial = Polynomial{theVariableNames};
+    for (const auto& [myCycleType, myCoefficient] : theCoefficientMap)
+    {
+        auto myExponents =
+            std::vector<Polynomial::Exponent>(theDegree.get(), Polynomial::Exponent{0});
+        for (const auto& myPart : myCycleType.parts())
+        {
+            myExponents[myPart.theLength.get() - 1] =
+                Polynomial::Exponent{myPart.theMultiplicity.get()};
+        }
+        myPolynomial.setUnchecked(Polynomial::Term{std::move(myExponents)}, myCoefficient);
+    }
+    return myPolynomial;
+}
+
+template <typename Coefficient>
+auto BasicCycleIndexPolynomial<Coefficient>::operator==(
+    const BasicCycleIndexPolynomial& aCycleIndex
+) const -> bool
+{
+    return theDegree == aCycleIndex.theDegree and theVariableNames == aCycleIndex.theVariableNames
+           and theCoefficientMap == aCycleIndex.theCoefficientMap;
+}
+
+template <typename Coefficient>
+auto BasicCycleIndexPolynomial<Coefficient>::toString() const -> std::string
+{
+    if constexpr (std::same_as<Coefficient, Rational>)
+    {
+        return toPolynomial().toString();
+    }
+    else
+    {
+        // Residues have no Polynomial, so the terms are written alike in cycle type order
+        if (isZero())
+        {
+            return "0";
+        }
+        auto myTerms = std::vector<std::string>{};
+        for (const auto& [myCycleType, myCoefficient] : theCoefficientMap)
+        {
+            auto myFactors = std::vector<std::string>{};
+            for (const auto& myPart : myCycleType.parts())
+            {
+                myFactors.push_back(
+                    theVariableNames[myPart.theLength.get() - 1].get() + '^'
+                    + std::to_string(myPart.theMultiplicity.get())
+                );
+            }
+            myTerms.push_back(
+                '+' + myCoefficient.toString()
+                + (myFactors | views::join('*') | ranges::to<std::string>())
+            );
+        }
+        return myTerms | views::join(' ') | ranges::to<std::string>();
+    }
+}
+
+template <typename Coefficient>
+auto operator<<(std::ostream& aStream, const BasicCycleIndexPolynomial<Coefficient>& aCycleIndex)
+    -> std::ostream&
+{
+    return aStream << aCycleIndex.toString();
+}
+
+template class BasicCycleIndexPolynomial<Rational>;
+template class BasicCycleIndexPolynomial<Modular>;
+template auto operator<<(std::ostream&, const CycleIndexPolynomial&) -> std::ostream&;
+template auto operator<<(std::ostream&, const ModularCycleIndex&) -> std::ostream&;
+} // namespace polya
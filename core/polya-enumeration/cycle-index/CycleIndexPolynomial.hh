@@ -0,0 +1,73 @@
+#pragma once
+
+#include "core/polya-enumeration/modular/Modular.hh"
+#include "core/polya-enumeration/permutation/CycleType.hh"
+#include "core/polya-enumeration/permutation/Permutation.hh"
+#include "core/polya-enumeration/polynomial/Polynomial.hh"
+#include "core/polya-enumeration/rational/Rational.hh"
+
+#include <concepts>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace polya
+{
+// A cycle index polynomial Z(x_1, ..., x_n) keyed by sparse cycle types. The monomial
+// x_1^c_1 * ... * x_n^c_n is stored as the cycle type {(k, c_k) : c_k > 0}, and is only expanded
+// to a dense exponent vector by toPolynomial().
+//
+// Coefficients are exact Rationals, or residues modulo a prime p > n for groups whose orders
+// outgrow 64 bits, e.g. S_n past n = 20. Modular indices take their modulus from their zero.
+template <typename Coefficient>
+class BasicCycleIndexPolynomial
+{
+public:
+    using Degree = Permutation::Degree;
+    using Terms = std::map<CycleType, Coefficient>;
+
+    // Variables default to x_1, ..., x_n
+    explicit BasicCycleIndexPolynomial(
+        Degree aDegree,
+        std::optional<std::vector<Polynomial::VariableName>> aVariableNames = std::nullopt,
+        Coefficient aZero = Coefficient{0}
+    );
+
+    [[nodiscard]] auto degree() const -> Degree;
+    [[nodiscard]] auto variables() const -> const std::vector<Polynomial::VariableName>&;
+    [[nodiscard]] auto zero() const -> const Coefficient&;
+
+    [[nodiscard]] auto coefficient(const CycleType& aCycleType) const -> Coefficient;
+    auto set(const CycleType& aCycleType, const Coefficient& aCoefficient) -> void;
+    auto add(const CycleType& aCycleType, const Coefficient& aCoefficient) -> void;
+
+    [[nodiscard]] auto isZero() const -> bool;
+    [[nodiscard]] auto terms() const -> const Terms&;
+
+    // Dense exponent vectors
+    [[nodiscard]] auto toPolynomial() const -> Polynomial
+        requires std::same_as<Coefficient, Rational>;
+
+    [[nodiscard]] auto operator==(const BasicCycleIndexPolynomial& aCycleIndex) const -> bool;
+
+    [[nodiscard]] auto toString() const -> std::string;
+
+private:
+    Degree theDegree;
+    std::vector<Polynomial::VariableName> theVariableNames;
+    Coefficient theZero; // Of the coefficient ring, e.g. carrying the modulus
+    Terms theCoefficientMap;
+};
+
+template <typename Coefficient>
+auto operator<<(std::ostream& aStream, const BasicCycleIndexPolynomial<Coefficient>& aCycleIndex)
+    -> std::ostream&;
+
+// Both are instantiated in CycleIndexPolynomial.cc
+using CycleIndexPolynomial = BasicCycleIndexPolynomial<Rational>;
+using ModularCycleIndex = BasicCycleIndexPolynomial<Modular>;
+extern template class BasicCycleIndexPolynomial<Rational>;
+extern template class BasicCycleIndexPolynomial<Modular>;
+} // namespace polya
@@ -0,0 +1,188 @@
+#include "core/polya-enumeration/cycle-index/CycleIndexAlgebra.hh"
+#include "core/polya-enumeration/cycle-index/CycleIndexPolynomial.hh"
+#include "core/polya-enumeration/modular/Modular.hh"
+#include "core/polya-enumeration/permutation/CycleType.hh"
+#include "core/polya-enumeration/rational/Rational.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace polya::test
+{
+using namespace ::testing;
+using Degree = CycleIndexPolynomial::Degree;
+using Length = CycleType::Length;
+using Multiplicity = CycleType::Multiplicity;
+using Part = CycleType::Part;
+
+class CycleIndexAlgebraTest : public ::testing::Test
+{
+};
+
+namespace
+{
+auto cycleType(const std::vector<std::pair<std::uint32_t, std::uint32_t>>& aParts) -> CycleType
+{
+    auto myParts = std::vector<Part>{};
+    for (const auto& [myLength, myMultiplicity] : aParts)
+    {
+        myParts.push_back(Part{Length{myLength}, Multiplicity{myMultiplicity}});
+    }
+    return CycleType{std::move(myParts)};
+}
+
+auto fraction(std::int64_t aNumerator, std::int64_t aDenominator) -> Rational
+{
+    return Rational{Rational::Numerator{aNumerator}, Rational::Denominator{aDenominator}};
+}
+} // namespace
+
+TEST_F(CycleIndexAlgebraTest, SymmetricCycleIndexFromPartitions)
+{
+    auto myExpected = CycleIndexPolynomial{Degree{3}};
+    myExpected.set(cycleType({{1, 3}}), fraction(1, 6));
+    myExpected.set(cycleType({{1, 1}, {2, 1}}), fraction(1, 2));
+    myExpected.set(cycleType({{3, 1}}), fraction(1, 3));
+    EXPECT_THAT(symmetricCycleIndex(Degree{3}), Eq(myExpected));
+
+    // One term per partition of 20, with coefficients summing to one
+    const auto myZ = symmetricCycleIndex(Degree{20});
+    EXPECT_THAT(myZ.terms().size(), Eq(627uz));
+    auto mySum = Rational{0};
+    for (const auto& [myCycleType, myCoefficient] : myZ.terms())
+    {
+        mySum += myCoefficient;
+    }
+    EXPECT_THAT(mySum, Eq(Rational{1}));
+
+    // 21! does not fit in 64 bits
+    EXPECT_THROW((void)symmetricCycleIndex(Degree{21}), std::runtime_error);
+}
+
+TEST_F(CycleIndexAlgebraTest, SymmetricCycleIndexModuloAPrime)
+{
+    const auto myModulus = Modular::Modulus{998244353};
+    const auto myOne = Modular{1, myModulus};
+    const auto myTwo = Modular{2, myModulus};
+    const auto mySix = Modular{6, myModulus};
+    const auto myZ3 = symmetricCycleIndex(Degree{3}, myModulus);
+    EXPECT_THAT(myZ3.coefficient(cycleType({{1, 3}})) * mySix, Eq(myOne));
+    EXPECT_THAT(myZ3.coefficient(cycleType({{1, 1}, {2, 1}})) * myTwo, Eq(myOne));
+
+    // Past the 64 bit limit, with one term per partition of 30 and coefficients summing to one
+    const auto myZ = symmetricCycleIndex(Degree{30}, myModulus);
+    EXPECT_THAT(myZ.terms().size(), Eq(5604uz));
+    auto mySum = Modular{0, myModulus};
+    for (const auto& [myCycleType, myCoefficient] : myZ.terms())
+    {
+        mySum += myCoefficient;
+    }
+    EXPECT_THAT(mySum, Eq(myOne));
+
+    // The products work alike on residues
+    const auto mySwap = symmetricCycleIndex(Degree{2}, myModulus);
+    const auto myWreath = wreathProduct(mySwap, mySwap);
+    EXPECT_THAT(myWreath.coefficient(cycleType({{4, 1}})) * myTwo * myTwo, Eq(myOne));
+
+    // z_lambda must be invertible
+    EXPECT_THROW((void)symmetricCycleIndex(Degree{7}, Modular::Modulus{7}), std::runtime_error);
+}
+
+TEST_F(CycleIndexAlgebraTest, InducedActionOnEdges)
+{
+    // S_3 permutes the three edges of a triangle as it permutes the vertices
+    EXPECT_THAT(
+        inducedCycleIndex(symmetricCycleIndex(Degree{3}), InducedAction::Edges),
+        Eq(symmetricCycleIndex(Degree{3}))
+    );
+
+    auto myExpected = CycleIndexPolynomial{Degree{6}};
+    myExpected.set(cycleType({{1, 6}}), fraction(1, 24));
+    myExpected.set(cycleType({{1, 2}, {2, 2}}), fraction(9, 24));
+    myExpected.set(cycleType({{3, 2}}), fraction(8, 24));
+    myExpected.set(cycleType({{2, 1}, {4, 1}}), fraction(6, 24));
+    EXPECT_THAT(
+        inducedCycleIndex(symmetricCycleIndex(Degree{4}), InducedAction::Edges), Eq(myExpected)
+    );
+}
+
+TEST_F(CycleIndexAlgebraTest, InducedActionOnOrderedPairs)
+{
+    const auto mySymmetric = symmetricCycleIndex(Degree{2});
+
+    auto myDirected = CycleIndexPolynomial{Degree{2}};
+    myDirected.set(cycleType({{1, 2}}), fraction(1, 2));
+    myDirected.set(cycleType({{2, 1}}), fraction(1, 2));
+    EXPECT_THAT(inducedCycleIndex(mySymmetric, InducedAction::DirectedEdges), Eq(myDirected));
+
+    auto myPairs = CycleIndexPolynomial{Degree{4}};
+    myPairs.set(cycleType({{1, 4}}), fraction(1, 2));
+    myPairs.set(cycleType({{2, 2}}), fraction(1, 2));
+    EXPECT_THAT(inducedCycleIndex(mySymmetric, InducedAction::OrderedPairs), Eq(myPairs));
+}
+
+TEST_F(CycleIndexAlgebraTest, SubsetsMatchEdgesAndComplements)
+{
+    const auto mySymmetric = symmetricCycleIndex(Degree{7});
+    EXPECT_THAT(
+        subsetCycleIndex(mySymmetric, 2), Eq(inducedCycleIndex(mySymmetric, InducedAction::Edges))
+    );
+    EXPECT_THAT(subsetCycleIndex(mySymmetric, 3), Eq(subsetCycleIndex(mySymmetric, 4)));
+    EXPECT_THAT(subsetCycleIndex(mySymmetric, 3).degree(), Eq(Degree{35}));
+
+    auto myEmpty = CycleIndexPolynomial{Degree{1}};
+    myEmpty.set(cycleType({{1, 1}}), Rational{1});
+    EXPECT_THAT(subsetCycleIndex(mySymmetric, 0), Eq(myEmpty));
+    EXPECT_THAT(subsetCycleIndex(mySymmetric, 7), Eq(myEmpty));
+    EXPECT_THROW((void)subsetCycleIndex(mySymmetric, 8), std::runtime_error);
+}
+
+TEST_F(CycleIndexAlgebraTest, ProductsOfSymmetricGroups)
+{
+    const auto mySwap = symmetricCycleIndex(Degree{2});
+
+    auto myDirect = CycleIndexPolynomial{Degree{4}};
+    myDirect.set(cycleType({{1, 4}}), fraction(1, 4));
+    myDirect.set(cycleType({{1, 2}, {2, 1}}), fraction(1, 2));
+    myDirect.set(cycleType({{2, 2}}), fraction(1, 4));
+    EXPECT_THAT(directProduct(mySwap, mySwap), Eq(myDirect));
+
+    auto myCartesian = CycleIndexPolynomial{Degree{4}};
+    myCartesian.set(cycleType({{1, 4}}), fraction(1, 4));
+    myCartesian.set(cycleType({{2, 2}}), fraction(3, 4));
+    EXPECT_THAT(cartesianProduct(mySwap, mySwap), Eq(myCartesian));
+
+    // S_2 wr S_2 is the symmetry group of a square
+    auto myWreath = CycleIndexPolynomial{Degree{4}};
+    myWreath.set(cycleType({{1, 4}}), fraction(1, 8));
+    myWreath.set(cycleType({{1, 2}, {2, 1}}), fraction(2, 8));
+    myWreath.set(cycleType({{2, 2}}), fraction(3, 8));
+    myWreath.set(cycleType({{4, 1}}), fraction(2, 8));
+    EXPECT_THAT(wreathProduct(mySwap, mySwap), Eq(myWreath));
+}
+
+TEST_F(CycleIndexAlgebraTest, ComposeSubstitutesScaledInnerIndex)
+{
+    const auto myPoint = symmetricCycleIndex(Degree{1});
+    const auto mySymmetric = symmetricCycleIndex(Degree{3});
+    EXPECT_THAT(compose(mySymmetric, myPoint), Eq(mySymmetric));
+    EXPECT_THAT(compose(myPoint, mySymmetric), Eq(mySymmetric));
+
+    // The p_2 / 2 of the outer index becomes (p_2^2 + p_4) / 4
+    const auto myCyclic = symmetricCycleIndex(Degree{2});
+    EXPECT_THAT(compose(myCyclic, myCyclic), Eq(wreathProduct(myCyclic, myCyclic)));
+    EXPECT_THAT(
+        compose(myCyclic, myCyclic).coefficient(cycleType({{4, 1}})), Eq(fraction(1, 4))
+    );
+
+    // Nested structures: three levels of S_2 are the 128 symmetries of a binary tree's leaves
+    const auto myTree = compose(myCyclic, compose(myCyclic, myCyclic));
+    EXPECT_THAT(myTree.degree(), Eq(Degree{8}));
+    EXPECT_THAT(myTree.coefficient(cycleType({{1, 8}})), Eq(fraction(1, 128)));
+    EXPECT_THAT(myTree, Eq(compose(compose(myCyclic, myCyclic), myCyclic)));
+}
+} // namespace polya::test
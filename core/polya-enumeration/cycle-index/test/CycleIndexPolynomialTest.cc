@@ -0,0 +1,104 @@
+#include "core/polya-enumeration/cycle-index/CycleIndexPolynomial.hh"
+#include "core/polya-enumeration/permutation/CycleType.hh"
+#include "core/polya-enumeration/polynomial/Polynomial.hh"
+#include "core/polya-enumeration/rational/Rational.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace polya::test
+{
+using namespace ::testing;
+using Degree = CycleIndexPolynomial::Degree;
+using Length = CycleType::Length;
+using Multiplicity = CycleType::Multiplicity;
+using Part = CycleType::Part;
+using VariableName = Polynomial::VariableName;
+using Exponent = Polynomial::Exponent;
+using Term = Polynomial::Term;
+
+class CycleIndexPolynomialTest : public ::testing::Test
+{
+};
+
+TEST_F(CycleIndexPolynomialTest, DefaultVariables)
+{
+    const auto myZ = CycleIndexPolynomial{Degree{3}};
+    EXPECT_THAT(myZ.isZero(), IsTrue());
+    EXPECT_THAT(
+        myZ.variables(), ElementsAre(VariableName{"x_1"}, VariableName{"x_2"}, VariableName{"x_3"})
+    );
+}
+
+TEST_F(CycleIndexPolynomialTest, WrongNumberOfVariablesThrows)
+{
+    EXPECT_THROW(
+        CycleIndexPolynomial(Degree{2}, std::vector{VariableName{"a"}}), std::runtime_error
+    );
+}
+
+TEST_F(CycleIndexPolynomialTest, AddAccumulatesCoefficients)
+{
+    auto myZ = CycleIndexPolynomial{Degree{4}};
+    const auto myCycleType = CycleType{std::vector{Part{Length{2}, Multiplicity{2}}}};
+    myZ.add(myCycleType, Rational{Rational::Numerator{1}, Rational::Denominator{4}});
+    myZ.add(myCycleType, Rational{Rational::Numerator{1}, Rational::Denominator{4}});
+    EXPECT_THAT(
+        myZ.coefficient(myCycleType),
+        Eq(Rational{Rational::Numerator{1}, Rational::Denominator{2}})
+    );
+    EXPECT_THAT(myZ.terms().size(), Eq(1));
+}
+
+TEST_F(CycleIndexPolynomialTest, ZeroCoefficientsAreNotStored)
+{
+    auto myZ = CycleIndexPolynomial{Degree{2}};
+    const auto myCycleType = CycleType{std::vector{Part{Length{1}, Multiplicity{2}}}};
+    myZ.set(myCycleType, Rational{1});
+    myZ.add(myCycleType, Rational{-1});
+    EXPECT_THAT(myZ.isZero(), IsTrue());
+}
+
+TEST_F(CycleIndexPolynomialTest, WrongDegreeThrows)
+{
+    auto myZ = CycleIndexPolynomial{Degree{4}};
+    EXPECT_THROW(
+        myZ.set(CycleType{std::vector{Part{Length{3}, Multiplicity{1}}}}, Rational{1}),
+        std::runtime_error
+    );
+}
+
+TEST_F(CycleIndexPolynomialTest, HighDegreeTermsStaySparse)
+{
+    auto myZ = CycleIndexPolynomial{Degree{200}};
+    const auto myCycleType = CycleType{std::vector{
+        Part{Length{1}, Multiplicity{2}}, Part{Length{99}, Multiplicity{2}}}};
+    myZ.set(myCycleType, Rational{1});
+    EXPECT_THAT(myZ.terms().begin()->first.parts().size(), Eq(2));
+}
+
+TEST_F(CycleIndexPolynomialTest, ToPolynomial)
+{
+    auto myZ = CycleIndexPolynomial{
+        Degree{3}, std::vector{VariableName{"a"}, VariableName{"b"}, VariableName{"c"}}};
+    myZ.set(
+        CycleType{std::vector{Part{Length{1}, Multiplicity{1}}, Part{Length{2}, Multiplicity{1}}}},
+        Rational{Rational::Numerator{1}, Rational::Denominator{2}}
+    );
+    myZ.set(
+        CycleType{std::vector{Part{Length{3}, Multiplicity{1}}}},
+        Rational{Rational::Numerator{1}, Rational::Denominator{2}}
+    );
+    const auto myPolynomial = myZ.toPolynomial();
+    EXPECT_THAT(
+        myPolynomial.coefficient(Term{std::vector{Exponent{1}, Exponent{1}, Exponent{0}}}),
+        Eq(Rational{Rational::Numerator{1}, Rational::Denominator{2}})
+    );
+    EXPECT_THAT(
+        myPolynomial.coefficient(Term{std::vector{Exponent{0}, Exponent{0}, Exponent{1}}}),
+        Eq(Rational{Rational::Numerator{1}, Rational::Denominator{2}})
+    );
+    EXPECT_THAT(myZ.toString(), Eq("+(1/2)c^1 +(1/2)a^1*b^1"));
+}
+
+} // namespace polya::test
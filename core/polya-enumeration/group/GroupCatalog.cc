@@ -0,0 +1,185 @@
+#include "core/polya-enumeration/group/GroupCatalog.hh"
+
+#include "core/util/Exception.hh"
+
+#include <limits>
+#include <utility>
+
+namespace polya
+{
+using Family = GroupCatalog::Family;
+using GroupPtr = GroupCatalog::GroupPtr;
+using Degree = Permutation::Degree;
+
+auto GroupCatalog::instance() -> GroupCatalog&
+{
+    static auto theInstance = GroupCatalog{};
+    return theInstance;
+}
+
+auto GroupCatalog::get(Family aFamily, Degree aDegree) -> GroupPtr
+{
+    if (aFamily == Family::Tetrahedron or aFamily == Family::Cube)
+    {
+        aDegree = Degree{0};
+    }
+    const auto myFamilyIndex = static_cast<std::size_t>(aFamily);
+    const auto myBlockIndex = aDegree.get() / theBlockSize;
+    const auto mySlotIndex = aDegree.get() % theBlockSize;
+    if (myBlockIndex >= theBlockCount)
+    {
+        return build(aFamily, aDegree); // Too large to cache
+    }
+
+    auto& myBlockPointer = theBlocks[myFamilyIndex][myBlockIndex];
+    if (const auto* myBlock = myBlockPointer.load(std::memory_order_acquire))
+    {
+        if (const auto* myEntry = myBlock->theSlots[mySlotIndex].load(std::memory_order_acquire))
+        {
+            return myEntry->theGroup;
+        }
+    }
+
+    auto myEntry = std::make_unique<Entry>(build(aFamily, aDegree));
+    auto& mySlot = block(myBlockPointer).theSlots[mySlotIndex];
+    const auto* myPublished = static_cast<const Entry*>(nullptr);
+    if (not mySlot.compare_exchange_strong(
+            myPublished, myEntry.get(), std::memory_order_acq_rel, std::memory_order_acquire
+        ))
+    {
+        return myPublished->theGroup; // Another thread published the group while we built it
+    }
+    theSize.fetch_add(1, std::memory_order_relaxed);
+    const auto myLock = std::scoped_lock{theOwnerMutex};
+    return theOwnedEntries.emplace_back(std::move(myEntry))->theGroup;
+}
+
+auto GroupCatalog::block(std::atomic<Block*>& aBlockPointer) -> Block&
+{
+    auto* myBlock = aBlockPointer.load(std::memory_order_acquire);
+    if (myBlock != nullptr)
+    {
+        return *myBlock;
+    }
+    auto myNewBlock = std::make_unique<Block>();
+    if (not aBlockPointer.compare_exchange_strong(
+            myBlock, myNewBlock.get(), std::memory_order_acq_rel, std::memory_order_acquire
+        ))
+    {
+        return *myBlock; // Lost the race; ours is freed unpublished
+    }
+    const auto myLock = std::scoped_lock{theOwnerMutex};
+    return *theOwnedBlocks.emplace_back(std::move(myNewBlock));
+}
+
+auto GroupCatalog::size() const -> std::size_t
+{
+    return theSize.load(std::memory_order_relaxed);
+}
+
+auto GroupCatalog::order(Family aFamily, Degree aDegree) -> std::uint64_t
+{
+    const auto myDegree = std::uint64_t{aDegree.get()};
+    switch (aFamily)
+    {
+    case Family::Cyclic:
+        return myDegree;
+    case Family::Dihedral:
+        return myDegree <= 2 ? myDegree : 2 * myDegree; // D_1 and D_2 collapse onto C_1 and C_2
+    case Family::Symmetric:
+    {
+        auto myOrder = std::uint64_t{1};
+        for (auto myFactor = std::uint64_t{2}; myFactor <= myDegree; ++myFactor)
+        {
+            if (myOrder > std::numeric_limits<std::uint64_t>::max() / myFactor)
+            {
+                return std::numeric_limits<std::uint64_t>::max();
+            }
+            myOrder *= myFactor;
+        }
+        return myOrder;
+    }
+    case Family::Trivial:
+        return 1;
+    case Family::Tetrahedron:
+        return 12;
+    case Family::Cube:
+        return 24;
+    }
+    throw_runtime_error("Unknown group family {}", static_cast<std::size_t>(aFamily));
+    std::unreachable();
+}
+
+auto GroupCatalog::degree(Family aFamily, Degree aDegree) -> Degree
+{
+    switch (aFamily)
+    {
+    case Family::Cyclic:
+    case Family::Dihedral:
+    case Family::Symmetric:
+    case Family::Trivial:
+        return aDegree;
+    case Family::Tetrahedron:
+        return Degree{4};
+    case Family::Cube:
+        return Degree{6};
+    }
+    throw_runtime_error("Unknown group family {}", static_cast<std::size_t>(aFamily));
+    std::unreachable();
+}
+
+auto GroupCatalog::build(Family aFamily, Degree aDegree) -> GroupPtr
+{
+    switch (aFamily)
+    {
+    case Family::Cyclic:
+        return std::make_shared<const PermutationGroup>(groups::cyclic(aDegree));
+    case Family::Dihedral:
+        return std::make_shared<const PermutationGroup>(groups::dihedral(aDegree));
+    case Family::Symmetric:
+        return std::make_shared<const PermutationGroup>(groups::symmetric(aDegree));
+    case Family::Trivial:
+        return std::make_shared<const PermutationGroup>(groups::trivial(aDegree));
+    case Family::Tetrahedron:
+        return std::make_shared<const PermutationGroup>(groups::tetrahedron());
+    case Family::Cube:
+        return std::make_shared<const PermutationGroup>(groups::cube());
+    }
+    throw_runtime_error("Unknown group family {}", static_cast<std::size_t>(aFamily));
+    std::unreachable();
+}
+
+namespace catalog
+{
+auto cyclic(Degree aDegree) -> GroupPtr
+{
+    return GroupCatalog::instance().get(Family::Cyclic, aDegree);
+}
+
+auto dihedral(Degree aDegree) -> GroupPtr
+{
+    return GroupCatalog::instance().get(Family::Dihedral, aDegree);
+}
+
+auto symmetric(Degree aDegree) -> GroupPtr
+{
+    return GroupCatalog::instance().get(Family::Symmetric, aDegree);
+}
+
+auto trivial(Degree aDegree) -> GroupPtr
+{
+    return GroupCatalog::instance().get(Family::Trivial, aDegree);
+}
+
+auto tetrahedron() -> GroupPtr
+{
+    return GroupCatalog::instance().get(Family::Tetrahedron, Degree{0});
+}
+
+auto cube() -> GroupPtr
+{
+    return GroupCatalog::instance().get(Family::Cube, Degree{0});
+}
+} // namespace catalog
+
+} // namespace polya
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "core/polya-enumeration/group/PermutationGroup.hh"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace polya
+{
+// Process-wide cache of the named groups in polya::groups. Each (family, degree) is generated once
+// and shared between callers. Lookups are lock-free. A missing group is built without holding any
+// lock and published with a compare-and-swap, so first requests for different groups run in
+// parallel; concurrent first requests for the same group may each build it, and all share the
+// one that is published.
+class GroupCatalog
+{
+public:
+    enum class Family : std::size_t
+    {
+        Cyclic,
+        Dihedral,
+        Symmetric,
+        Trivial,
+        Tetrahedron,
+        Cube,
+    };
+    using Degree = Permutation::Degree;
+    using GroupPtr = std::shared_ptr<const PermutationGroup>;
+
+    [[nodiscard]] static auto instance() -> GroupCatalog&;
+
+    // Degrees of fixed-degree families (Tetrahedron, Cube) are ignored
+    [[nodiscard]] auto get(Family aFamily, Degree aDegree) -> GroupPtr;
+    [[nodiscard]] auto size() const -> std::size_t; // Number of cached groups
+
+    // Without building the group; orders saturate at the maximum of std::uint64_t
+    [[nodiscard]] static auto order(Family aFamily, Degree aDegree) -> std::uint64_t;
+    [[nodiscard]] static auto degree(Family aFamily, Degree aDegree) -> Degree;
+
+private:
+    static constexpr auto theFamilyCount = 6uz;
+    static constexpr auto theBlockSize = 64uz;
+    static constexpr auto theBlockCount = 64uz; // Degrees up to 4095 are cached
+
+    struct Entry
+    {
+        GroupPtr theGroup;
+    };
+    struct Block
+    {
+        std::array<std::atomic<const Entry*>, theBlockSize> theSlots{};
+    };
+
+    [[nodiscard]] static auto build(Family aFamily, Degree aDegree) -> GroupPtr;
+    [[nodiscard]] auto block(std::atomic<Block*>& aBlockPointer) -> Block&;
+
+    // Entries are published once and never freed, so readers can dereference without locking
+    std::array<std::array<std::atomic<Block*>, theBlockCount>, theFamilyCount> theBlocks{};
+    std::atomic<std::size_t> theSize{0};
+    std::mutex theOwnerMutex; // Guards only the two lists below, never a build
+    std::vector<std::unique_ptr<Block>> theOwnedBlocks;
+    std::vector<std::unique_ptr<Entry>> theOwnedEntries;
+};
+
+// Shared, memoized versions of the constructors in polya::groups
+namespace catalog
+{
+auto cyclic(Permutation::Degree aDegree) -> GroupCatalog::GroupPtr;
+auto dihedral(Permutation::Degree aDegree) -> GroupCatalog::GroupPtr;
+auto symmetric(Permutation::Degree aDegree) -> GroupCatalog::GroupPtr;
+auto trivial(Permutation::Degree aDegree) -> GroupCatalog::GroupPtr;
+auto tetrahedron() -> GroupCatalog::GroupPtr;
+auto cube() -> GroupCatalog::GroupPtr;
+} // namespace catalog
+
+} // namespace polya
@@ -1,12 +1,17 @@
 #include "core/polya-enumeration/group/PermutationGroup.hh"
 
 #include "core/util/Exception.hh"
+#include "core/util/Stats.hh"
+#include "core/util/ThreadPool.hh"
+#include "core/util/Trace.hh"
 
 #include <functional>
-#include <queue>
+#include <iterator>
 #include <range/v3/all.hpp>
 #include <set>
+#include <span>
 #include <utility>
+#include <vector>
 
 namespace polya
 {
@@ -17,10 +22,17 @@ using Cycle = Permutation::Cycle;
 
 namespace
 {
+// Frontier elements multiplied by the generators per task
+constexpr auto theFrontierGrain = 64uz;
+
 // Finds the subgroup generated by a set of elements
-auto generateSubgroup(Degree aDegree, const PermutationGroup::Generators& aGenerators)
-    -> PermutationGroup::Elements
+auto generateSubgroup(
+    Degree aDegree, const PermutationGroup::Generators& aGenerators,
+    const ExecutionContext& aContext
+) -> PermutationGroup::Elements
 {
+    const auto myTimer = stats::ScopedTimer{stats::Phase::GroupGeneration};
+    const auto mySpan = trace::Span{"group generation"};
     ensure(
         ranges::all_of(
             aGenerators.get() | views::transform(&Permutation::degree),
@@ -37,21 +49,52 @@ auto generateSubgroup(Degree aDegree, const PermutationGroup::Generators& aGener
 
     auto myElements = std::set<Permutation>{myIdentity}; // identity is in every subgroup
 
-    auto mySearchFrontier = std::queue<Permutation>{};
-    mySearchFrontier.push(myIdentity);
-    while (not mySearchFrontier.empty())
+    // Breadth first, one layer at a time: the products of a layer are formed in parallel while
+    // myElements is only read, then the new ones are inserted to form the next layer
+    auto myFrontier = std::vector<Permutation>{myIdentity};
+    while (not myFrontier.empty())
     {
-        const auto myFrontierElement = mySearchFrontier.front();
-        mySearchFrontier.pop();
-        for (const auto& myNewElement :
-             myGenerators
-                 | views::transform([&myFrontierElement](const auto& myGenerator)
-                                    { return myFrontierElement * myGenerator; })
-                 | views::filter([&myElements](const auto& myElement)
-                                 { return not myElements.contains(myElement); }))
+        // A layer holds up to |frontier| |generators| candidates before any is inserted, so they
+        // are reported with the elements before the layer is formed
+        const auto myHeld = myElements.size() + myFrontier.size() * myGenerators.size();
+        aContext.checkpoint(stats::Phase::GroupGeneration, myHeld);
+        auto myCandidates = parallelReduce(
+            0uz, myFrontier.size(), theFrontierGrain, std::vector<Permutation>{},
+            [&](std::size_t aBegin, std::size_t anEnd)
+            {
+                aContext.checkpoint(stats::Phase::GroupGeneration, myHeld);
+                auto myProducts = std::vector<Permutation>{};
+                for (const auto& myFrontierElement :
+                     std::span{myFrontier}.subspan(aBegin, anEnd - aBegin))
+                {
+                    for (const auto& myGenerator : myGenerators)
+                    {
+                        auto myProduct = myFrontierElement * myGenerator;
+                        if (not myElements.contains(myProduct))
+                        {
+                            myProducts.push_back(std::move(myProduct));
+                        }
+                    }
+                }
+                return myProducts;
+            },
+            [](std::vector<Permutation>&& aResult, std::vector<Permutation>&& aProducts)
+            {
+                aResult.insert(
+                    aResult.end(), std::make_move_iterator(aProducts.begin()),
+                    std::make_move_iterator(aProducts.end())
+                );
+                return std::move(aResult);
+            }
+        );
+        myFrontier.clear();
+        for (auto& myCandidate : myCandidates)
         {
-            myElements.insert(myNewElement);
-            mySearchFrontier.push(myNewElement);
+            if (myElements.insert(myCandidate).second)
+            {
+                stats::count(stats::Counter::MapInsertions);
+                myFrontier.push_back(std::move(myCandidate));
+            }
         }
     }
     return PermutationGroup::Elements{myElements | ranges::to<std::vector<Permutation>>()};
@@ -66,10 +109,45 @@ PermutationGroup::PermutationGroup(std::string_view aName, Elements anElements)
 }
 
 PermutationGroup::PermutationGroup(
-    std::string_view aName, Degree aDegree, const Generators& aGenerators
+    std::string_view aName, Degree aDegree, const Generators& aGenerators,
+    const ExecutionContext& aContext
 )
-    : theName{aName}, theElements{generateSubgroup(aDegree, aGenerators)}
+    : theName{aName}, theElements{generateSubgroup(aDegree, aGenerators, aContext)}
+{
+}
+
+auto PermutationGroup::tryFromElements(std::string_view aName, Elements anElements)
+    -> Expected<PermutationGroup>
 {
+    if (anElements.get().empty())
+    {
+        return std::unexpected{Error{Error::Code::EmptyGroup}};
+    }
+    const auto myDegree = anElements.get().front().degree();
+    for (const auto& myElement : anElements.get())
+    {
+        if (myElement.degree() != myDegree)
+        {
+            return std::unexpected{Error{
+                Error::Code::ElementDegreeMismatch, myElement.degree().get(), myDegree.get()}};
+        }
+    }
+    return PermutationGroup{aName, std::move(anElements)};
+}
+
+auto PermutationGroup::tryFromGenerators(
+    std::string_view aName, Degree aDegree, const Generators& aGenerators
+) -> Expected<PermutationGroup>
+{
+    for (const auto& myGenerator : aGenerators.get())
+    {
+        if (myGenerator.degree() != aDegree)
+        {
+            return std::unexpected{Error{
+                Error::Code::GeneratorDegreeMismatch, myGenerator.degree().get(), aDegree.get()}};
+        }
+    }
+    return PermutationGroup{aName, aDegree, aGenerators};
 }
 
 auto PermutationGroup::name() const -> std::string_view
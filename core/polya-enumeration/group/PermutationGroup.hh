@@ -2,6 +2,8 @@
 
 #include "core/polya-enumeration/permutation/Permutation.hh"
 
+#include "core/util/Error.hh"
+#include "core/util/ExecutionContext.hh"
 #include "core/util/Type.hh"
 
 #include <cstdint>
@@ -22,9 +24,19 @@ public:
 
     explicit PermutationGroup(std::string_view aName, Elements anElements);
     explicit PermutationGroup(
-        std::string_view aName, Degree aDegree, const Generators& aGenerators
+        std::string_view aName,
+        Degree aDegree,
+        const Generators& aGenerators,
+        const ExecutionContext& aContext = ExecutionContext::unlimited()
     );
 
+    // Non-throwing alternatives to the constructors for untrusted input
+    [[nodiscard]] static auto tryFromElements(std::string_view aName, Elements anElements)
+        -> Expected<PermutationGroup>;
+    [[nodiscard]] static auto tryFromGenerators(
+        std::string_view aName, Degree aDegree, const Generators& aGenerators
+    ) -> Expected<PermutationGroup>;
+
     [[nodiscard]] auto name() const -> std::string_view;
     [[nodiscard]] auto order() const -> Order;
     [[nodiscard]] auto degree() const -> Degree;
@@ -0,0 +1,124 @@
+#include "core/polya-enumeration/group/GroupCatalog.hh"
+#include "core/polya-enumeration/group/PermutationGroup.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <latch>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace polya::test
+{
+using namespace ::testing;
+using Degree = Permutation::Degree;
+using Family = GroupCatalog::Family;
+using Order = PermutationGroup::Order;
+
+class GroupCatalogTest : public ::testing::Test
+{
+};
+
+TEST_F(GroupCatalogTest, MatchesGroupConstructors)
+{
+    EXPECT_THAT(
+        catalog::cyclic(Degree{5})->elements().get(),
+        Eq(groups::cyclic(Degree{5}).elements().get())
+    );
+    EXPECT_THAT(catalog::dihedral(Degree{4})->order(), Eq(Order{8}));
+    EXPECT_THAT(catalog::symmetric(Degree{4})->order(), Eq(Order{24}));
+    EXPECT_THAT(catalog::trivial(Degree{3})->degree(), Eq(Degree{3}));
+    EXPECT_THAT(catalog::tetrahedron()->name(), Eq("Tetrahedron"));
+    EXPECT_THAT(catalog::cube()->name(), Eq("Cube"));
+}
+
+TEST_F(GroupCatalogTest, RepeatedLookupsShareTheGroup)
+{
+    const auto myFirst = catalog::dihedral(Degree{6});
+    const auto mySecond = catalog::dihedral(Degree{6});
+    EXPECT_THAT(myFirst.get(), Eq(mySecond.get()));
+    EXPECT_THAT(catalog::cyclic(Degree{6}).get(), Ne(myFirst.get()));
+    EXPECT_THAT(catalog::cube().get(), Eq(catalog::cube().get()));
+}
+
+TEST_F(GroupCatalogTest, SizeCountsDistinctGroups)
+{
+    auto& myCatalog = GroupCatalog::instance();
+    [[maybe_unused]] const auto myGroup = myCatalog.get(Family::Cyclic, Degree{17});
+    const auto mySize = myCatalog.size();
+    [[maybe_unused]] const auto mySameGroup = myCatalog.get(Family::Cyclic, Degree{17});
+    EXPECT_THAT(myCatalog.size(), Eq(mySize));
+    [[maybe_unused]] const auto myOtherGroup = myCatalog.get(Family::Cyclic, Degree{18});
+    EXPECT_THAT(myCatalog.size(), Eq(mySize + 1));
+}
+
+TEST_F(GroupCatalogTest, InvalidDegreeThrows)
+{
+    EXPECT_THROW(catalog::cyclic(Degree{0}), std::runtime_error);
+}
+
+TEST_F(GroupCatalogTest, ConcurrentLookupsShareTheGroup)
+{
+    auto myResults = std::vector<const PermutationGroup*>(8, nullptr);
+    {
+        auto myThreads = std::vector<std::jthread>{};
+        for (auto& myResult : myResults)
+        {
+            myThreads.emplace_back([&myResult]
+                                   { myResult = catalog::symmetric(Degree{5}).get(); });
+        }
+    }
+    EXPECT_THAT(myResults, Each(Eq(myResults.front())));
+    EXPECT_THAT(myResults.front()->order(), Eq(Order{120}));
+}
+
+TEST_F(GroupCatalogTest, ConcurrentFirstLookupsPublishOneGroup)
+{
+    // A degree in a block no other test touches, so the block and the group are both new
+    auto& myCatalog = GroupCatalog::instance();
+    const auto mySize = myCatalog.size();
+    auto myResults = std::vector<const PermutationGroup*>(8, nullptr);
+    auto myStart = std::latch{static_cast<std::ptrdiff_t>(myResults.size())};
+    {
+        auto myThreads = std::vector<std::jthread>{};
+        for (auto& myResult : myResults)
+        {
+            myThreads.emplace_back(
+                [&]
+                {
+                    myStart.arrive_and_wait();
+                    myResult = myCatalog.get(Family::Trivial, Degree{3000}).get();
+                }
+            );
+        }
+    }
+    EXPECT_THAT(myResults, Each(Eq(myResults.front())));
+    EXPECT_THAT(myCatalog.get(Family::Trivial, Degree{3000}).get(), Eq(myResults.front()));
+    EXPECT_THAT(myCatalog.size(), Eq(mySize + 1));
+}
+
+TEST_F(GroupCatalogTest, OrderAndDegreeWithoutBuilding)
+{
+    auto& myCatalog = GroupCatalog::instance();
+    for (const auto myFamily :
+         {Family::Cyclic, Family::Dihedral, Family::Symmetric, Family::Trivial,
+          Family::Tetrahedron, Family::Cube})
+    {
+        for (auto myDegree = 1uz; myDegree <= 6; ++myDegree)
+        {
+            const auto myGroup = myCatalog.get(myFamily, Degree{myDegree});
+            EXPECT_THAT(
+                GroupCatalog::order(myFamily, Degree{myDegree}), Eq(myGroup->order().get())
+            );
+            EXPECT_THAT(GroupCatalog::degree(myFamily, Degree{myDegree}), Eq(myGroup->degree()));
+        }
+    }
+    EXPECT_THAT(
+        GroupCatalog::order(Family::Symmetric, Degree{21}),
+        Eq(std::numeric_limits<std::uint64_t>::max())
+    );
+}
+
+} // namespace polya::test
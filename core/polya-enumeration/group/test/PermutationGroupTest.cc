@@ -4,7 +4,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <cstddef>
 #include <sstream>
+#include <stop_token>
 
 namespace polya::test
 {
@@ -55,6 +58,48 @@ TEST_F(PermutationGroupTest, InvalidDegreeInGeneratorThrows)
     );
 }
 
+TEST_F(PermutationGroupTest, TryFromElements)
+{
+    const auto myGroup = PermutationGroup::tryFromElements(
+        "S_2", Elements{std::vector{
+                   Permutation{Degree{2}}, Permutation{std::vector{Element{1}, Element{0}}}}}
+    );
+    ASSERT_THAT(myGroup.has_value(), IsTrue());
+    EXPECT_THAT(myGroup->order(), Eq(Order{2}));
+}
+
+TEST_F(PermutationGroupTest, TryFromElementsErrors)
+{
+    EXPECT_THAT(
+        PermutationGroup::tryFromElements("empty", Elements{std::vector<Permutation>{}}).error(),
+        Eq(Error{Error::Code::EmptyGroup})
+    );
+    EXPECT_THAT(
+        PermutationGroup::tryFromElements(
+            "mixed", Elements{std::vector{Permutation{Degree{2}}, Permutation{Degree{3}}}}
+        )
+            .error(),
+        Eq(Error{Error::Code::ElementDegreeMismatch, 3, 2})
+    );
+}
+
+TEST_F(PermutationGroupTest, TryFromGenerators)
+{
+    const auto myGroup = PermutationGroup::tryFromGenerators(
+        "C_3", Degree{3}, Generators{std::vector{permutations::rotation(Degree{3})}}
+    );
+    ASSERT_THAT(myGroup.has_value(), IsTrue());
+    EXPECT_THAT(myGroup->order(), Eq(Order{3}));
+
+    const auto myInvalidGroup = PermutationGroup::tryFromGenerators(
+        "bad", Degree{3}, Generators{std::vector{Permutation{Degree{4}}}}
+    );
+    ASSERT_THAT(myInvalidGroup.has_value(), IsFalse());
+    EXPECT_THAT(
+        myInvalidGroup.error().message(), Eq("Generator has degree 4, but the group has degree 3")
+    );
+}
+
 TEST_F(PermutationGroupTest, Name)
 {
     const auto myGroup = groups::cyclic(Degree{3});
@@ -156,4 +201,39 @@ TEST_F(PermutationGroupTest, InvalidGroup)
     EXPECT_THAT(myNotAGroup.isValidGroup(), IsFalse());
 }
 
+TEST_F(PermutationGroupTest, GenerationStopsWhenCancelled)
+{
+    auto mySource = std::stop_source{};
+    mySource.request_stop();
+    const auto myGenerators = Generators{std::vector{
+        Permutation{std::vector{Element{1}, Element{2}, Element{3}, Element{0}}},
+        Permutation{std::vector{Element{1}, Element{0}, Element{2}, Element{3}}}}};
+    EXPECT_THROW(
+        PermutationGroup("S_4", Degree{4}, myGenerators, ExecutionContext{mySource.get_token()}),
+        Interrupted
+    );
+}
+
+TEST_F(PermutationGroupTest, GenerationReportsCandidatesBeforeEachLayer)
+{
+    // The last layer is reported with the 24 elements and the candidates it is about to form
+    auto myHeld = std::atomic<std::size_t>{0};
+    const auto myContext = ExecutionContext{
+        std::stop_token{}, std::nullopt,
+        [&myHeld](const ExecutionContext::Progress& aProgress)
+        {
+            auto myPrevious = myHeld.load();
+            while (aProgress.theProcessed > myPrevious
+                   and not myHeld.compare_exchange_weak(myPrevious, aProgress.theProcessed))
+            {
+            }
+        }};
+    const auto myGenerators = Generators{std::vector{
+        Permutation{std::vector{Element{1}, Element{2}, Element{3}, Element{0}}},
+        Permutation{std::vector{Element{1}, Element{0}, Element{2}, Element{3}}}}};
+    const auto myGroup = PermutationGroup{"S_4", Degree{4}, myGenerators, myContext};
+    EXPECT_THAT(myGroup.order(), Eq(Order{24}));
+    EXPECT_THAT(myHeld.load(), Gt(24uz));
+}
+
 } // namespace polya::test
@@ -0,0 +1,156 @@
+#include "core/polya-enumeration/modular/Modular.hh"
+
+#include "core/util/Exception.hh"
+
+#include <utility>
+
+namespace polya
+{
+namespace
+{
+constexpr auto theModulusLimit = std::uint64_t{1} << 31;
+} // namespace
+
+Modular::Modular(std::int64_t anInteger, Modulus aModulus)
+    : theValue{0}, theModulus{aModulus}
+{
+    ensure(
+        aModulus.get() >= 2 and aModulus.get() < theModulusLimit,
+        "Expected a modulus between 2 and 2^31, but received {}", aModulus.get()
+    );
+    const auto myModulus = static_cast<std::int64_t>(aModulus.get());
+    theValue = static_cast<std::uint32_t>((anInteger % myModulus + myModulus) % myModulus);
+}
+
+auto Modular::value() const -> std::uint32_t
+{
+    return theValue;
+}
+
+auto Modular::modulus() const -> Modulus
+{
+    return theModulus;
+}
+
+auto Modular::inverse() const -> Modular
+{
+    // Extended Euclid on (value, p), keeping only the coefficient of the value
+    auto myRemainder = static_cast<std::int64_t>(theValue);
+    auto myPreviousRemainder = static_cast<std::int64_t>(theModulus.get());
+    auto myCoefficient = std::int64_t{1};
+    auto myPreviousCoefficient = std::int64_t{0};
+    while (myRemainder != 0)
+    {
+        const auto myQuotient = myPreviousRemainder / myRemainder;
+        myPreviousRemainder -= myQuotient * myRemainder;
+        std::swap(myRemainder, myPreviousRemainder);
+        myPreviousCoefficient -= myQuotient * myCoefficient;
+        std::swap(myCoefficient, myPreviousCoefficient);
+    }
+    ensure(
+        myPreviousRemainder == 1, "{} has no inverse modulo {}", theValue, theModulus.get()
+    );
+    return Modular{myPreviousCoefficient, theModulus};
+}
+
+auto Modular::pow(std::uint64_t anExponent) const -> Modular
+{
+    auto myResult = Modular{1, theModulus};
+    auto myBase = *this;
+    while (anExponent > 0)
+    {
+        if (anExponent % 2 == 1)
+        {
+            myResult *= myBase;
+        }
+        anExponent /= 2;
+        myBase *= myBase;
+    }
+    return myResult;
+}
+
+auto Modular::operator+=(const Modular& aModular) -> Modular&
+{
+    checkModulus(aModular);
+    // Both are below 2^31, so the sum does not wrap
+    theValue += aModular.theValue;
+    if (theValue >= theModulus.get())
+    {
+        theValue -= theModulus.get();
+    }
+    return *this;
+}
+
+auto Modular::operator-=(const Modular& aModular) -> Modular&
+{
+    checkModulus(aModular);
+    theValue = theValue >= aModular.theValue ? theValue - aModular.theValue
+                                             : theValue + (theModulus.get() - aModular.theValue);
+    return *this;
+}
+
+auto Modular::operator*=(const Modular& aModular) -> Modular&
+{
+    checkModulus(aModular);
+    theValue = static_cast<std::uint32_t>(
+        std::uint64_t{theValue} * aModular.theValue % theModulus.get()
+    );
+    return *this;
+}
+
+auto Modular::operator/=(const Modular& aModular) -> Modular&
+{
+    return *this *= aModular.inverse();
+}
+
+auto Modular::operator+(const Modular& aModular) const -> Modular
+{
+    auto myResult = *this;
+    myResult += aModular;
+    return myResult;
+}
+
+auto Modular::operator-(const Modular& aModular) const -> Modular
+{
+    auto myResult = *this;
+    myResult -= aModular;
+    return myResult;
+}
+
+auto Modular::operator*(const Modular& aModular) const -> Modular
+{
+    auto myResult = *this;
+    myResult *= aModular;
+    return myResult;
+}
+
+auto Modular::operator/(const Modular& aModular) const -> Modular
+{
+    auto myResult = *this;
+    myResult /= aModular;
+    return myResult;
+}
+
+auto Modular::operator==(const Modular& aModular) const -> bool
+{
+    return theValue == aModular.theValue and theModulus == aModular.theModulus;
+}
+
+auto Modular::toString() const -> std::string
+{
+    return std::to_string(theValue);
+}
+
+auto operator<<(std::ostream& aStream, const Modular& aModular) -> std::ostream&
+{
+    return aStream << aModular.toString();
+}
+
+auto Modular::checkModulus(const Modular& aModular) const -> void
+{
+    ensure(
+        theModulus == aModular.theModulus, "Cannot combine residues modulo {} and {}",
+        theModulus.get(), aModular.theModulus.get()
+    );
+}
+} // namespace polya
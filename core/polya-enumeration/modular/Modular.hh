@@ -0,0 +1,47 @@
+#pragma once
+
+#include "core/util/Type.hh"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace polya
+{
+// A residue modulo p < 2^31, for counts that outgrow 64 bit Rationals. Products of two residues
+// fit in 64 bits, and dividing by n multiplies by the inverse of n mod p, which exists for every
+// n that p does not divide when p is prime. Operands must have the same modulus.
+class Modular
+{
+public:
+    using Modulus = Type<std::uint32_t, struct ModulusTag>;
+
+    explicit Modular(std::int64_t anInteger, Modulus aModulus); // Reduced into [0, p)
+
+    [[nodiscard]] auto value() const -> std::uint32_t;
+    [[nodiscard]] auto modulus() const -> Modulus;
+
+    [[nodiscard]] auto inverse() const -> Modular; // Throws if the value shares a factor with p
+    [[nodiscard]] auto pow(std::uint64_t anExponent) const -> Modular;
+
+    auto operator+=(const Modular& aModular) -> Modular&;
+    auto operator-=(const Modular& aModular) -> Modular&;
+    auto operator*=(const Modular& aModular) -> Modular&;
+    auto operator/=(const Modular& aModular) -> Modular&;
+    [[nodiscard]] auto operator+(const Modular& aModular) const -> Modular;
+    [[nodiscard]] auto operator-(const Modular& aModular) const -> Modular;
+    [[nodiscard]] auto operator*(const Modular& aModular) const -> Modular;
+    [[nodiscard]] auto operator/(const Modular& aModular) const -> Modular;
+
+    [[nodiscard]] auto operator==(const Modular& aModular) const -> bool;
+
+    [[nodiscard]] auto toString() const -> std::string;
+    friend auto operator<<(std::ostream& aStream, const Modular& aModular) -> std::ostream&;
+
+private:
+    auto checkModulus(const Modular& aModular) const -> void;
+
+    std::uint32_t theValue;
+    Modulus theModulus;
+};
+} // namespace polya
@@ -0,0 +1,55 @@
+#include "core/polya-enumeration/modular/Modular.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+namespace polya::test
+{
+using namespace ::testing;
+using Modulus = Modular::Modulus;
+
+class ModularTest : public ::testing::Test
+{
+};
+
+TEST_F(ModularTest, ReducesIntoRange)
+{
+    EXPECT_THAT(Modular(12, Modulus{7}).value(), Eq(5u));
+    EXPECT_THAT(Modular(-1, Modulus{7}).value(), Eq(6u));
+    EXPECT_THAT(Modular(-14, Modulus{7}).value(), Eq(0u));
+    EXPECT_THROW(Modular(1, Modulus{1}), std::runtime_error);
+    EXPECT_THROW(Modular(1, Modulus{1u << 31}), std::runtime_error);
+}
+
+TEST_F(ModularTest, Arithmetic)
+{
+    const auto myModulus = Modulus{7};
+    const auto myFive = Modular{5, myModulus};
+    const auto myThree = Modular{3, myModulus};
+    EXPECT_THAT(myFive + myThree, Eq(Modular{1, myModulus}));
+    EXPECT_THAT(myThree - myFive, Eq(Modular{5, myModulus}));
+    EXPECT_THAT(myFive * myThree, Eq(Modular{1, myModulus}));
+    EXPECT_THAT(myFive / myThree * myThree, Eq(myFive));
+    EXPECT_THAT(myThree.pow(6), Eq(Modular{1, myModulus}));
+    EXPECT_THAT(myFive.toString(), Eq("5"));
+}
+
+TEST_F(ModularTest, ProductsNearTheLargestModulusDoNotOverflow)
+{
+    const auto myModulus = Modulus{2147483647}; // 2^31 - 1
+    const auto myMinusOne = Modular{-1, myModulus};
+    EXPECT_THAT(myMinusOne * myMinusOne, Eq(Modular{1, myModulus}));
+    EXPECT_THAT(myMinusOne + myMinusOne, Eq(Modular{-2, myModulus}));
+    const auto myThousand = Modular{1000, myModulus};
+    EXPECT_THAT(myThousand.inverse() * myThousand, Eq(Modular{1, myModulus}));
+}
+
+TEST_F(ModularTest, InvalidOperandsThrow)
+{
+    EXPECT_THROW((void)Modular(0, Modulus{7}).inverse(), std::runtime_error);
+    EXPECT_THROW((void)Modular(4, Modulus{8}).inverse(), std::runtime_error);
+    EXPECT_THROW((void)(Modular(1, Modulus{7}) + Modular(1, Modulus{11})), std::runtime_error);
+}
+} // namespace polya::test
@@ -1,8 +1,12 @@
 #include "core/polya-enumeration/orbit-counting/OrbitCounting.hh"
 
 #include "core/polya-enumeration/rational/Rational.hh"
+#include "core/util/Exception.hh"
 #include "core/util/Power.hh"
+#include "core/util/Stats.hh"
 
+#include <cstdint>
+#include <limits>
 #include <range/v3/all.hpp>
 
 namespace polya::orbits
@@ -11,6 +15,7 @@ namespace views = ranges::views;
 
 auto countOrbits(const PermutationGroup& aGroup, ColourCount aColourCount) -> OrbitCount
 {
+    const auto myTimer = stats::ScopedTimer{stats::Phase::OrbitCounting};
     const auto myGroupOrderFactor =
         Rational{Rational::Numerator{1}, Rational::Denominator{aGroup.order().get()}};
     const auto myOrbitCount = ranges::accumulate(
@@ -18,11 +23,16 @@ auto countOrbits(const PermutationGroup& aGroup, ColourCount aColourCount) -> Or
             | views::transform(
                 [aColourCount, myGroupOrderFactor](const Permutation& aPermutation)
                 {
-                    const auto myNumerator = mathutil::power(
-                        mathutil::Base{aColourCount.get()},
-                        mathutil::Exponent{aPermutation.asCycles().size()}
+                    const auto myExponent = mathutil::Exponent{aPermutation.asCycles().size()};
+                    const auto myNumerator =
+                        mathutil::power(mathutil::Base{aColourCount.get()}, myExponent);
+                    ensure(
+                        myNumerator.get() <= std::numeric_limits<std::int64_t>::max(),
+                        "Expected {}^{} to fit in a Rational", aColourCount.get(),
+                        myExponent.get()
                     );
-                    return Rational{myNumerator.get()} * myGroupOrderFactor;
+                    return Rational{static_cast<std::int64_t>(myNumerator.get())}
+                           * myGroupOrderFactor;
                 }
             ),
         Rational{0}
@@ -92,4 +92,11 @@ TEST_F(OrbitCountingTest, CubeFaces50Colours)
     EXPECT_THAT(orbits::countOrbits(myGroup, ColourCount{50}), Eq(OrbitCount{651'886'250}));
 }
 
+TEST_F(OrbitCountingTest, ColouringsPast63BitsThrow)
+{
+    // The identity fixes 2^64 colourings, which must not wrap to zero
+    const auto myGroup = groups::cyclic(Permutation::Degree{64});
+    EXPECT_THROW((void)orbits::countOrbits(myGroup, ColourCount{2}), std::runtime_error);
+}
+
 } // namespace polya::test
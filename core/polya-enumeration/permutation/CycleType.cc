@@ -0,0 +1,140 @@
+#include "core/polya-enumeration/permutation/CycleType.hh"
+
+#include <algorithm>
+#include <functional>
+#include <range/v3/all.hpp>
+#include <utility>
+
+namespace polya
+{
+namespace views = ranges::views;
+using Part = CycleType::Part;
+
+auto CycleType::Hash::operator()(const CycleType& aCycleType) const noexcept -> std::size_t
+{
+    auto myHash = std::size_t{aCycleType.theParts.size()};
+    for (const auto& myPart : aCycleType.theParts)
+    {
+        const auto myValue = (std::size_t{myPart.theLength.get()} << 32)
+                             | std::size_t{myPart.theMultiplicity.get()};
+        myHash ^= std::hash<std::size_t>{}(myValue) + 0x9e3779b97f4a7c15uz + (myHash << 6)
+                  + (myHash >> 2);
+    }
+    return myHash;
+}
+
+CycleType::CycleType(std::vector<Part> aParts) : theParts{std::move(aParts)}
+{
+    std::ranges::sort(
+        theParts, [](const Part& aLhs, const Part& aRhs)
+        { return aLhs.theLength.get() < aRhs.theLength.get(); }
+    );
+    auto myMerged = std::vector<Part>{};
+    myMerged.reserve(theParts.size());
+    for (const auto& myPart : theParts)
+    {
+        if (myPart.theMultiplicity.get() == 0)
+        {
+            continue;
+        }
+        if (not myMerged.empty() and myMerged.back().theLength == myPart.theLength)
+        {
+            myMerged.back().theMultiplicity.get() += myPart.theMultiplicity.get();
+            continue;
+        }
+        myMerged.push_back(myPart);
+    }
+    theParts = std::move(myMerged);
+}
+
+auto CycleType::parts() const -> const std::vector<Part>&
+{
+    return theParts;
+}
+
+auto CycleType::multiplicity(Length aLength) const -> Multiplicity
+{
+    const auto myPart = std::ranges::lower_bound(
+        theParts, aLength.get(), std::less{},
+        [](const Part& aPart) { return aPart.theLength.get(); }
+    );
+    return myPart != theParts.end() and myPart->theLength == aLength ? myPart->theMultiplicity
+                                                                     : Multiplicity{0};
+}
+
+auto CycleType::degree() const -> Degree
+{
+    const auto myDegree = ranges::accumulate(
+        theParts
+            | views::transform([](const Part& aPart)
+                               { return std::size_t{aPart.theLength.get()}
+                                        * aPart.theMultiplicity.get(); }),
+        0uz
+    );
+    return Degree{myDegree};
+}
+
+auto CycleType::cycleCount() const -> Count
+{
+    const auto myCount = ranges::accumulate(
+        theParts
+            | views::transform([](const Part& aPart)
+                               { return std::size_t{aPart.theMultiplicity.get()}; }),
+        0uz
+    );
+    return Count{myCount};
+}
+
+auto CycleType::operator*=(const CycleType& aCycleType) -> CycleType&
+{
+    auto myParts = theParts;
+    myParts.insert(myParts.end(), aCycleType.theParts.begin(), aCycleType.theParts.end());
+    *this = CycleType{std::move(myParts)};
+    return *this;
+}
+
+auto CycleType::operator*(const CycleType& aCycleType) const -> CycleType
+{
+    auto myResult = *this;
+    myResult *= aCycleType;
+    return myResult;
+}
+
+auto CycleType::operator==(const CycleType& aCycleType) const -> bool
+{
+    return theParts == aCycleType.theParts;
+}
+
+auto CycleType::operator<=>(const CycleType& aCycleType) const -> std::strong_ordering
+{
+    return std::lexicographical_compare_three_way(
+        theParts.begin(), theParts.end(), aCycleType.theParts.begin(), aCycleType.theParts.end(),
+        [](const Part& aLhs, const Part& aRhs)
+        {
+            if (const auto myOrder = aLhs.theLength.get() <=> aRhs.theLength.get(); myOrder != 0)
+            {
+                return myOrder;
+            }
+            return aLhs.theMultiplicity.get() <=> aRhs.theMultiplicity.get();
+        }
+    );
+}
+
+auto CycleType::toString() const -> std::string
+{
+    const auto myFormatPart = [](const Part& aPart)
+    {
+        return std::to_string(aPart.theLength.get()) + '^'
+               + std::to_string(aPart.theMultiplicity.get());
+    };
+    return '[' + (theParts | views::transform(myFormatPart) | views::join(' ')
+                  | ranges::to<std::string>())
+           + ']';
+}
+
+auto operator<<(std::ostream& aStream, const CycleType& aCycleType) -> std::ostream&
+{
+    return aStream << aCycleType.toString();
+}
+
+} // namespace polya
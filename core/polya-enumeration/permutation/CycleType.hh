@@ -0,0 +1,57 @@
+#pragma once
+
+#include "core/util/Type.hh"
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace polya
+{
+// The cycle type of a permutation, stored sparsely as (length, multiplicity) pairs sorted by
+// length. A degree 200 permutation with three distinct cycle lengths is stored as three pairs.
+class CycleType
+{
+public:
+    using Degree = Type<std::size_t, struct DegreeTag>; // Same type as Permutation::Degree
+    using Count = Type<std::size_t, struct CountTag>;
+    using Length = Type<std::uint32_t, struct CycleLengthTag>;
+    using Multiplicity = Type<std::uint32_t, struct CycleMultiplicityTag>;
+
+    struct Part
+    {
+        Length theLength;
+        Multiplicity theMultiplicity;
+
+        [[nodiscard]] auto operator==(const Part& aPart) const -> bool = default;
+    };
+
+    struct Hash
+    {
+        auto operator()(const CycleType& aCycleType) const noexcept -> std::size_t;
+    };
+
+    CycleType() = default;
+    explicit CycleType(std::vector<Part> aParts); // Parts may be unsorted and repeated
+
+    [[nodiscard]] auto parts() const -> const std::vector<Part>&;
+    [[nodiscard]] auto multiplicity(Length aLength) const -> Multiplicity;
+    [[nodiscard]] auto degree() const -> Degree;     // Sum of length * multiplicity
+    [[nodiscard]] auto cycleCount() const -> Count; // Sum of multiplicities
+
+    auto operator*=(const CycleType& aCycleType) -> CycleType&; // Monomial product
+    [[nodiscard]] auto operator*(const CycleType& aCycleType) const -> CycleType;
+
+    [[nodiscard]] auto operator==(const CycleType& aCycleType) const -> bool;
+    [[nodiscard]] auto operator<=>(const CycleType& aCycleType) const -> std::strong_ordering;
+
+    [[nodiscard]] auto toString() const -> std::string;
+    friend auto operator<<(std::ostream& aStream, const CycleType& aCycleType) -> std::ostream&;
+
+private:
+    std::vector<Part> theParts; // Sorted by length, no zero multiplicities
+};
+} // namespace polya
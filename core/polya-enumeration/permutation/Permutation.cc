@@ -1,11 +1,13 @@
 #include "core/polya-enumeration/permutation/Permutation.hh"
 
 #include "core/util/Exception.hh"
+#include "core/util/Stats.hh"
 
 #include <algorithm>
 #include <cmath>
 #include <range/v3/all.hpp>
 #include <utility>
+#include <vector>
 
 namespace polya
 {
@@ -38,6 +40,8 @@ Permutation::Permutation(std::vector<Element> aBijection) : theBijection{std::mo
 
 Permutation::Permutation(Degree aDegree, const std::vector<Cycle>& aCycles) : Permutation{aDegree}
 {
+    // An element in two places would map two elements to one
+    auto mySeen = std::vector<bool>(aDegree.get(), false);
     for (const auto& myCycle : aCycles)
     {
         const auto& myElements = myCycle.get();
@@ -48,14 +52,41 @@ Permutation::Permutation(Degree aDegree, const std::vector<Cycle>& aCycles) : Pe
                 "Cycle element {} is not in the domain of permutation with degree {}",
                 myElements[myIndex].get(), aDegree.get()
             );
+            ensure(
+                not mySeen[myElements[myIndex].get()],
+                "Cycle element {} appears more than once in permutation with degree {}",
+                myElements[myIndex].get(), aDegree.get()
+            );
+            mySeen[myElements[myIndex].get()] = true;
             theBijection[myElements[myIndex].get()] = myElements[(myIndex + 1) % myElements.size()];
         }
     }
 }
 
+auto Permutation::tryFromCycles(Degree aDegree, const std::vector<Cycle>& aCycles)
+    -> Expected<Permutation>
+{
+    auto mySeen = std::vector<bool>(aDegree.get(), false);
+    for (const auto& myElement : aCycles | views::transform(&Cycle::underlying) | views::join)
+    {
+        if (myElement.get() >= aDegree.get())
+        {
+            return std::unexpected{
+                Error{Error::Code::ElementOutOfDomain, myElement.get(), aDegree.get()}};
+        }
+        if (mySeen[myElement.get()])
+        {
+            return std::unexpected{
+                Error{Error::Code::RepeatedElement, myElement.get(), aDegree.get()}};
+        }
+        mySeen[myElement.get()] = true;
+    }
+    return Permutation{aDegree, aCycles};
+}
+
 auto Permutation::operator()(Element anElement) const -> Element
 {
-    ensure(
+    ensure_debug(
         isValidElement(anElement), "Element {} is not in the domain of permutation with degree {}",
         anElement.get(), degree().get()
     );
@@ -63,9 +94,15 @@ auto Permutation::operator()(Element anElement) const -> Element
     return theBijection[anElement.get()];
 }
 
+auto Permutation::operator[](Element anElement) const noexcept -> Element
+{
+    return theBijection[anElement.get()];
+}
+
 auto Permutation::operator*=(const Permutation& aPermutation) -> Permutation&
 {
     ensure(degree() == aPermutation.degree(), "Cannot compose permutations of different degrees");
+    stats::count(stats::Counter::PermutationProducts);
     theBijection =
         aPermutation.theBijection
         | views::transform([&](const Element& anElement) { return theBijection[anElement.get()]; })
@@ -169,6 +206,34 @@ auto Permutation::cycleStructure() const -> CycleStructure
     return CycleStructure{std::move(myDistribution)};
 }
 
+auto Permutation::cycleType() const -> CycleType
+{
+    auto myVisited = std::vector<bool>(degree().get(), false);
+    auto myLengths = std::vector<CycleType::Length::UnderlyingT>{};
+    for (const auto myElement : views::iota(0uz, degree().get()))
+    {
+        if (myVisited[myElement])
+        {
+            continue;
+        }
+        auto myLength = CycleType::Length::UnderlyingT{0};
+        for (auto myCurrent = myElement; not myVisited[myCurrent];
+             myCurrent = theBijection[myCurrent].get())
+        {
+            myVisited[myCurrent] = true;
+            ++myLength;
+        }
+        myLengths.push_back(myLength);
+    }
+    return CycleType{
+        myLengths
+        | views::transform(
+            [](const auto aLength)
+            { return CycleType::Part{CycleType::Length{aLength}, CycleType::Multiplicity{1}}; }
+        )
+        | ranges::to<std::vector>()};
+}
+
 auto Permutation::toString() const -> std::string
 {
     const auto myElementToString = [](const Element& anElement)
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "core/polya-enumeration/permutation/CycleType.hh"
+#include "core/util/Error.hh"
 #include "core/util/Type.hh"
 
 #include <compare>
@@ -32,7 +34,12 @@ public:
     explicit Permutation(std::vector<Element> aBijection);
     explicit Permutation(Degree aDegree, const std::vector<Cycle>& aCycles);
 
-    [[nodiscard]] auto operator()(Element anElement) const -> Element;
+    // Non-throwing alternative to the cycle constructor for untrusted input
+    [[nodiscard]] static auto tryFromCycles(Degree aDegree, const std::vector<Cycle>& aCycles)
+        -> Expected<Permutation>;
+
+    [[nodiscard]] auto operator()(Element anElement) const -> Element; // Checked in debug builds
+    [[nodiscard]] auto operator[](Element anElement) const noexcept -> Element; // Unchecked
     auto operator*=(const Permutation& aPermutation) -> Permutation&; // Permutation composition
     auto operator*(const Permutation& aPermutation) const -> Permutation;
 
@@ -47,6 +54,7 @@ public:
     [[nodiscard]] auto isIdentity() const noexcept -> bool;
     [[nodiscard]] auto asCycles() const -> std::vector<Cycle>;
     [[nodiscard]] auto cycleStructure() const -> CycleStructure;
+    [[nodiscard]] auto cycleType() const -> CycleType; // Sparse, without materializing cycles
 
     [[nodiscard]] auto toString() const -> std::string;
     friend auto operator<<(std::ostream& aStream, const Permutation& aPermutation) -> std::ostream&;
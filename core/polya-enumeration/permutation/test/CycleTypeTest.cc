@@ -0,0 +1,84 @@
+#include "core/polya-enumeration/permutation/CycleType.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <unordered_set>
+
+namespace polya::test
+{
+using namespace ::testing;
+using Length = CycleType::Length;
+using Multiplicity = CycleType::Multiplicity;
+using Part = CycleType::Part;
+
+class CycleTypeTest : public ::testing::Test
+{
+};
+
+TEST_F(CycleTypeTest, DefaultIsEmpty)
+{
+    const auto myCycleType = CycleType{};
+    EXPECT_THAT(myCycleType.parts(), IsEmpty());
+    EXPECT_THAT(myCycleType.degree(), Eq(CycleType::Degree{0}));
+}
+
+TEST_F(CycleTypeTest, PartsAreSortedAndMerged)
+{
+    const auto myCycleType = CycleType{std::vector{
+        Part{Length{3}, Multiplicity{1}}, Part{Length{1}, Multiplicity{2}},
+        Part{Length{3}, Multiplicity{2}}, Part{Length{2}, Multiplicity{0}}}};
+    EXPECT_THAT(
+        myCycleType.parts(),
+        ElementsAre(Part{Length{1}, Multiplicity{2}}, Part{Length{3}, Multiplicity{3}})
+    );
+    EXPECT_THAT(myCycleType.degree(), Eq(CycleType::Degree{11}));
+    EXPECT_THAT(myCycleType.cycleCount(), Eq(CycleType::Count{5}));
+}
+
+TEST_F(CycleTypeTest, Multiplicity)
+{
+    const auto myCycleType = CycleType{std::vector{Part{Length{200}, Multiplicity{1}}}};
+    EXPECT_THAT(myCycleType.multiplicity(Length{200}), Eq(Multiplicity{1}));
+    EXPECT_THAT(myCycleType.multiplicity(Length{1}), Eq(Multiplicity{0}));
+    EXPECT_THAT(myCycleType.multiplicity(Length{300}), Eq(Multiplicity{0}));
+}
+
+TEST_F(CycleTypeTest, Product)
+{
+    const auto myFirst = CycleType{std::vector{Part{Length{1}, Multiplicity{2}}}};
+    const auto mySecond =
+        CycleType{std::vector{Part{Length{1}, Multiplicity{1}}, Part{Length{4}, Multiplicity{1}}}};
+    EXPECT_THAT(
+        (myFirst * mySecond).parts(),
+        ElementsAre(Part{Length{1}, Multiplicity{3}}, Part{Length{4}, Multiplicity{1}})
+    );
+}
+
+TEST_F(CycleTypeTest, Ordering)
+{
+    const auto myFirst = CycleType{std::vector{Part{Length{1}, Multiplicity{2}}}};
+    const auto mySecond = CycleType{std::vector{Part{Length{2}, Multiplicity{1}}}};
+    EXPECT_THAT(myFirst, Lt(mySecond));
+    EXPECT_THAT(myFirst, Eq(CycleType{std::vector{Part{Length{1}, Multiplicity{2}}}}));
+}
+
+TEST_F(CycleTypeTest, Hash)
+{
+    const auto myCycleTypes = std::unordered_set<CycleType, CycleType::Hash>{
+        CycleType{std::vector{Part{Length{1}, Multiplicity{2}}}},
+        CycleType{std::vector{Part{Length{1}, Multiplicity{2}}}},
+        CycleType{std::vector{Part{Length{2}, Multiplicity{1}}}}};
+    EXPECT_THAT(myCycleTypes.size(), Eq(2));
+}
+
+TEST_F(CycleTypeTest, ToString)
+{
+    std::ostringstream myStream;
+    myStream << CycleType{
+        std::vector{Part{Length{2}, Multiplicity{1}}, Part{Length{1}, Multiplicity{3}}}};
+    EXPECT_THAT(myStream.str(), Eq("[1^3 2^1]"));
+}
+
+} // namespace polya::test
@@ -1,4 +1,5 @@
 #include "core/polya-enumeration/permutation/Permutation.hh"
+#include "core/util/Exception.hh"
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -61,6 +62,9 @@ TEST_F(PermutationTest, CycleConstructorWithMultipleCycles)
 
 TEST_F(PermutationTest, NotInDomainThrows)
 {
+#ifndef UTIL_DEBUG
+    GTEST_SKIP() << "Internal checks are compiled out";
+#endif
     const auto myPermutation = Permutation{Degree{3}};
     EXPECT_THROW(
         [[maybe_unused]] const auto myValue = myPermutation(Element{3}), std::runtime_error
@@ -72,6 +76,44 @@ TEST_F(PermutationTest, NotInDomainCycleElementThrows)
     EXPECT_THROW(Permutation(Degree{3}, {Cycle{{Element{0}, Element{5}}}}), std::runtime_error);
 }
 
+TEST_F(PermutationTest, TryFromCycles)
+{
+    const auto myPermutation =
+        Permutation::tryFromCycles(Degree{3}, {Cycle{{Element{0}, Element{2}}}});
+    ASSERT_THAT(myPermutation.has_value(), IsTrue());
+    EXPECT_THAT(*myPermutation, Eq(Permutation{std::vector{Element{2}, Element{1}, Element{0}}}));
+}
+
+TEST_F(PermutationTest, TryFromCyclesNotInDomain)
+{
+    const auto myPermutation =
+        Permutation::tryFromCycles(Degree{3}, {Cycle{{Element{0}, Element{5}}}});
+    ASSERT_THAT(myPermutation.has_value(), IsFalse());
+    EXPECT_THAT(myPermutation.error(), Eq(Error{Error::Code::ElementOutOfDomain, 5, 3}));
+    EXPECT_THAT(
+        myPermutation.error().message(),
+        Eq("Cycle element 5 is not in the domain of permutation with degree 3")
+    );
+}
+
+TEST_F(PermutationTest, TryFromCyclesRepeatedElement)
+{
+    // (0 1)(1 2) and (0 0 1) would both send two elements to the same image
+    const auto myOverlapping =
+        std::vector{Cycle{{Element{0}, Element{1}}}, Cycle{{Element{1}, Element{2}}}};
+    const auto myRepeating = std::vector{Cycle{{Element{0}, Element{0}, Element{1}}}};
+    EXPECT_THAT(
+        Permutation::tryFromCycles(Degree{3}, myOverlapping).error(),
+        Eq(Error{Error::Code::RepeatedElement, 1, 3})
+    );
+    EXPECT_THAT(
+        Permutation::tryFromCycles(Degree{3}, myRepeating).error(),
+        Eq(Error{Error::Code::RepeatedElement, 0, 3})
+    );
+    EXPECT_THROW(Permutation(Degree{3}, myOverlapping), std::runtime_error);
+    EXPECT_THROW(Permutation(Degree{3}, myRepeating), std::runtime_error);
+}
+
 TEST_F(PermutationTest, CompositionWithIdentity)
 {
     const auto myPermutation = Permutation{std::vector{Element{1}, Element{2}, Element{0}}};
@@ -90,6 +132,14 @@ TEST_F(PermutationTest, Composition)
     EXPECT_THAT(myComposed(Element{2}), Eq(Element{0}));
 }
 
+TEST_F(PermutationTest, CompositionOfDifferentDegreesThrows)
+{
+    EXPECT_THROW(
+        [[maybe_unused]] const auto myComposed = Permutation{Degree{3}} * Permutation{Degree{4}},
+        std::runtime_error
+    );
+}
+
 TEST_F(PermutationTest, InverseOfIdentityIsIdentity)
 {
     const auto myIdentity = Permutation{Degree{3}};
@@ -179,6 +229,21 @@ TEST_F(PermutationTest, CycleStructureThreeCycle)
     EXPECT_THAT(myStructure.theCycleLengthDistribution[3].get(), Eq(1));
 }
 
+TEST_F(PermutationTest, CycleTypeMatchesCycleStructure)
+{
+    const auto myPermutation = Permutation{
+        std::vector{Element{1}, Element{2}, Element{0}, Element{4}, Element{3}, Element{5}}};
+    const auto myCycleType = myPermutation.cycleType();
+    EXPECT_THAT(myCycleType.parts().size(), Eq(3));
+    EXPECT_THAT(myCycleType.multiplicity(CycleType::Length{1}), Eq(CycleType::Multiplicity{1}));
+    EXPECT_THAT(myCycleType.multiplicity(CycleType::Length{2}), Eq(CycleType::Multiplicity{1}));
+    EXPECT_THAT(myCycleType.multiplicity(CycleType::Length{3}), Eq(CycleType::Multiplicity{1}));
+    EXPECT_THAT(myCycleType.degree(), Eq(Degree{6}));
+    EXPECT_THAT(
+        myCycleType.cycleCount().get(), Eq(myPermutation.cycleStructure().totalCycleCount().get())
+    );
+}
+
 TEST_F(PermutationTest, EqualPermutations)
 {
     const auto myA = Permutation{std::vector{Element{1}, Element{0}}};
@@ -0,0 +1,42 @@
+#include "core/polya-enumeration/polya/Async.hh"
+
+#include "core/polya-enumeration/polya/Polya.hh"
+
+#include <utility>
+
+namespace polya::async
+{
+auto cycleIndexPolynomial(
+    std::shared_ptr<const PermutationGroup> aGroup,
+    std::optional<std::vector<Polynomial::VariableName>> aVariableNames, ThreadPool& aPool
+) -> Job<CycleIndexPolynomial>
+{
+    return submit(
+        aPool,
+        [myGroup = std::move(aGroup),
+         myVariableNames = std::move(aVariableNames)](std::stop_token aStopToken)
+        {
+            return polya::cycleIndexPolynomial(
+                *myGroup, myVariableNames, ExecutionContext{std::move(aStopToken)}
+            );
+        }
+    );
+}
+
+auto evaluateColours(
+    CycleIndexPolynomial aCycleIndex, orbits::ColourCount aColourCount,
+    std::optional<std::vector<Polynomial::VariableName>> aColourNames, ThreadPool& aPool
+) -> Job<Polynomial>
+{
+    return submit(
+        aPool,
+        [myCycleIndex = std::move(aCycleIndex), aColourCount,
+         myColourNames = std::move(aColourNames)](std::stop_token aStopToken)
+        {
+            return polya::evaluateColours(
+                myCycleIndex, aColourCount, myColourNames, ExecutionContext{std::move(aStopToken)}
+            );
+        }
+    );
+}
+} // namespace polya::async
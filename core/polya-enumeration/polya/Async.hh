@@ -0,0 +1,160 @@
+#pragma once
+
+#include "core/polya-enumeration/cycle-index/CycleIndexPolynomial.hh"
+#include "core/polya-enumeration/group/PermutationGroup.hh"
+#include "core/polya-enumeration/orbit-counting/OrbitCounting.hh"
+#include "core/polya-enumeration/polynomial/Polynomial.hh"
+#include "core/util/ThreadPool.hh"
+
+#include <chrono>
+#include <concepts>
+#include <exception>
+#include <future>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <stop_token>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Asynchronous versions of the Polya entry points. Each call queues one job on a thread pool
+// (the library's shared pool by default) and returns at once, so many independent jobs overlap.
+namespace polya::async
+{
+// Rethrown by Job::get() for a job cancelled before it started
+class Cancelled : public std::runtime_error
+{
+public:
+    Cancelled() : std::runtime_error{"The job was cancelled before it started"} {}
+};
+
+// The pending result of a queued job
+template <typename T>
+class Job
+{
+public:
+    Job(std::future<T> aFuture, std::stop_source aStopSource)
+        : theFuture{std::move(aFuture)}, theStopSource{std::move(aStopSource)}
+    {
+    }
+
+    // Waits for the result. Rethrows the job's exception, or Cancelled. Can only be called once.
+    [[nodiscard]] auto get() -> T
+    {
+        return theFuture.get();
+    }
+
+    auto wait() const -> void
+    {
+        theFuture.wait();
+    }
+
+    template <typename Rep, typename Period>
+    [[nodiscard]] auto waitFor(const std::chrono::duration<Rep, Period>& aTimeout) const -> bool
+    {
+        return theFuture.wait_for(aTimeout) == std::future_status::ready;
+    }
+
+    [[nodiscard]] auto isReady() const -> bool
+    {
+        return waitFor(std::chrono::seconds{0});
+    }
+
+    // A job that has not started yet is skipped, and get() throws Cancelled. A running job stops
+    // at its next checkpoint if it was given the stop token, and get() throws Interrupted.
+    auto cancel() -> void
+    {
+        theStopSource.request_stop();
+    }
+
+    [[nodiscard]] auto stopToken() const -> std::stop_token
+    {
+        return theStopSource.get_token();
+    }
+
+private:
+    std::future<T> theFuture;
+    std::stop_source theStopSource;
+};
+
+namespace detail
+{
+template <typename Function>
+struct JobResult
+{
+    using Type = std::invoke_result_t<Function&>;
+};
+
+template <typename Function>
+    requires std::invocable<Function&, std::stop_token>
+struct JobResult<Function>
+{
+    using Type = std::invoke_result_t<Function&, std::stop_token>;
+};
+} // namespace detail
+
+// Queues aFunction on aPool, passing it the job's stop token if it takes one. Blocks while the
+// pool's queue is full.
+template <typename Function>
+auto submit(ThreadPool& aPool, Function aFunction)
+    -> Job<typename detail::JobResult<Function>::Type>
+{
+    using Result = typename detail::JobResult<Function>::Type;
+    auto myPromise = std::promise<Result>{};
+    auto myJob = Job<Result>{myPromise.get_future(), std::stop_source{}};
+    aPool.submit(
+        [myPromise = std::move(myPromise), myToken = myJob.stopToken(),
+         myFunction = std::move(aFunction)]() mutable
+        {
+            if (myToken.stop_requested())
+            {
+                myPromise.set_exception(std::make_exception_ptr(Cancelled{}));
+                return;
+            }
+            const auto call = [&]
+            {
+                if constexpr (std::invocable<Function&, std::stop_token>)
+                {
+                    return myFunction(myToken);
+                }
+                else
+                {
+                    return myFunction();
+                }
+            };
+            try
+            {
+                if constexpr (std::is_void_v<Result>)
+                {
+                    call();
+                    myPromise.set_value();
+                }
+                else
+                {
+                    myPromise.set_value(call());
+                }
+            }
+            catch (...)
+            {
+                myPromise.set_exception(std::current_exception());
+            }
+        }
+    );
+    return myJob;
+}
+
+auto cycleIndexPolynomial(
+    std::shared_ptr<const PermutationGroup> aGroup,
+    std::optional<std::vector<Polynomial::VariableName>> aVariableNames = std::nullopt,
+    ThreadPool& aPool = ThreadPool::shared()
+) -> Job<CycleIndexPolynomial>;
+
+auto evaluateColours(
+    CycleIndexPolynomial aCycleIndex,
+    orbits::ColourCount aColourCount,
+    std::optional<std::vector<Polynomial::VariableName>> aColourNames = std::nullopt,
+    ThreadPool& aPool = ThreadPool::shared()
+) -> Job<Polynomial>;
+
+} // namespace polya::async
@@ -0,0 +1,384 @@
+#include "core/polya-enumeration/polya/ColourCoefficients.hh"
+
+#include "core/polya-enumeration/polya/Polya.hh"
+#include "core/util/Exception.hh"
+#include "core/util/Stats.hh"
+#include "core/util/Trace.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <range/v3/all.hpp>
+#include <utility>
+
+namespace polya
+{
+using Exponent = Polynomial::Exponent;
+using Rank = ColourCoefficients::Rank;
+
+namespace
+{
+constexpr auto theOverflow = std::int64_t{-1};
+
+// Weak compositions of aTotal into aParts parts, C(aTotal + aParts - 1, aParts - 1), or nullopt
+// if they do not fit in 64 bits
+auto compositions(std::uint64_t aTotal, std::uint64_t aParts) -> std::optional<std::uint64_t>
+{
+    if (aParts == 0)
+    {
+        return aTotal == 0 ? 1 : 0;
+    }
+    const auto myBottom = std::min(aParts - 1, aTotal);
+    const auto myTop = aTotal + aParts - 1;
+    auto myResult = static_cast<unsigned __int128>(1);
+    for (auto myIndex = 1uz; myIndex <= myBottom; ++myIndex)
+    {
+        // Exact, as the product of myIndex consecutive integers is divisible by myIndex!
+        myResult = myResult * (myTop - myBottom + myIndex) / myIndex;
+        if (myResult > std::numeric_limits<std::uint64_t>::max())
+        {
+            return std::nullopt;
+        }
+    }
+    return static_cast<std::uint64_t>(myResult);
+}
+
+auto checkedMultiply(std::int64_t aFirst, std::int64_t aSecond) -> std::int64_t
+{
+    auto myResult = std::int64_t{0};
+    ensure(
+        aFirst != theOverflow and aSecond != theOverflow
+            and not __builtin_mul_overflow(aFirst, aSecond, &myResult),
+        "Colour coefficient overflows 64 bits"
+    );
+    return myResult;
+}
+
+auto checkedAdd(std::int64_t aFirst, std::int64_t aSecond) -> std::int64_t
+{
+    auto myResult = std::int64_t{0};
+    ensure(
+        not __builtin_add_overflow(aFirst, aSecond, &myResult),
+        "Colour coefficient overflows 64 bits"
+    );
+    return myResult;
+}
+
+// The next weak composition in lexicographic order, false after the last one (n, 0, ..., 0)
+auto advance(std::vector<Exponent>& anExponents) -> bool
+{
+    auto myLast = anExponents.size();
+    while (myLast > 0 and anExponents[myLast - 1].get() == 0)
+    {
+        --myLast;
+    }
+    if (myLast <= 1)
+    {
+        return false;
+    }
+    const auto myValue = anExponents[myLast - 1].get();
+    anExponents[myLast - 1] = Exponent{0};
+    ++anExponents[myLast - 2].get();
+    anExponents.back() = Exponent{myValue - 1};
+    return true;
+}
+} // namespace
+
+ColourCoefficients::ColourCoefficients(
+    const CycleIndexPolynomial& aCycleIndex, orbits::ColourCount aColourCount,
+    const std::optional<std::vector<Polynomial::VariableName>>& aColourNames
+)
+    : theDegree{static_cast<std::uint32_t>(aCycleIndex.degree().get())},
+      theColourNames{colourVariables(aColourCount, aColourNames)}
+{
+    ensure(aColourCount.get() > 0, "Expected at least one colour");
+    auto myLargestMultiplicity = 0u;
+    for (const auto& [myCycleType, myCoefficient] : aCycleIndex.terms())
+    {
+        auto& myTerm = theTerms.emplace_back(CycleTerm{{}, {}, myCoefficient});
+        for (const auto& myPart : myCycleType.parts())
+        {
+            myTerm.theLengths.push_back(myPart.theLength.get());
+            myTerm.theMultiplicities.push_back(myPart.theMultiplicity.get());
+            myLargestMultiplicity = std::max(myLargestMultiplicity, myPart.theMultiplicity.get());
+        }
+        // Longest cycles first, so that the search for a colour's cycles fails early
+        std::ranges::reverse(myTerm.theLengths);
+        std::ranges::reverse(myTerm.theMultiplicities);
+    }
+
+    // Pascal's triangle, with theOverflow past 64 bits
+    theBinomials.resize(myLargestMultiplicity + 1);
+    for (auto myTop = 0uz; myTop <= myLargestMultiplicity; ++myTop)
+    {
+        auto& myRow = theBinomials[myTop];
+        myRow.assign(myTop + 1, 1);
+        for (auto myBottom = 1uz; myBottom < myTop; ++myBottom)
+        {
+            const auto myLeft = theBinomials[myTop - 1][myBottom - 1];
+            const auto myRight = theBinomials[myTop - 1][myBottom];
+            if (myLeft == theOverflow or myRight == theOverflow
+                or __builtin_add_overflow(myLeft, myRight, &myRow[myBottom]))
+            {
+                myRow[myBottom] = theOverflow;
+            }
+        }
+    }
+}
+
+auto ColourCoefficients::variables() const -> const std::vector<Polynomial::VariableName>&
+{
+    return theColourNames;
+}
+
+auto ColourCoefficients::size() const -> std::uint64_t
+{
+    const auto mySize = compositions(theDegree, theColourNames.size());
+    ensure(
+        mySize.has_value(), "Expected at most 2^64 colour terms for degree {} and {} colours",
+        theDegree, theColourNames.size()
+    );
+    return *mySize;
+}
+
+auto ColourCoefficients::coefficient(const Polynomial::Term& aTerm) const -> Rational
+{
+    const auto& myExponents = aTerm.get();
+    const auto myTotal = ranges::accumulate(
+        myExponents, std::uint64_t{0},
+        [](std::uint64_t aSum, const Exponent& anExponent) { return aSum + anExponent.get(); }
+    );
+    if (myExponents.size() != theColourNames.size() or myTotal != theDegree)
+    {
+        return Rational{0};
+    }
+    auto myScratch = std::vector<std::uint32_t>{};
+    return coefficient(myExponents, myScratch);
+}
+
+auto ColourCoefficients::term(Rank aRank) const -> Polynomial::Term
+{
+    ensure(
+        aRank.get() < size(), "Expected a rank below {}, but received {}", size(), aRank.get()
+    );
+    const auto myColourCount = theColourNames.size();
+    auto myExponents = std::vector<Exponent>(myColourCount, Exponent{0});
+    auto myRemaining = theDegree;
+    auto myRank = aRank.get();
+    for (auto myColour = 0uz; myColour + 1 < myColourCount; ++myColour)
+    {
+        // Skip the compositions with a smaller exponent at this colour
+        auto myValue = 0u;
+        for (;; ++myValue)
+        {
+            const auto myCount =
+                *compositions(myRemaining - myValue, myColourCount - myColour - 1);
+            if (myRank < myCount)
+            {
+                break;
+            }
+            myRank -= myCount;
+        }
+        myExponents[myColour] = Exponent{myValue};
+        myRemaining -= myValue;
+    }
+    myExponents.back() = Exponent{myRemaining};
+    return Polynomial::Term{std::move(myExponents)};
+}
+
+auto ColourCoefficients::rank(const Polynomial::Term& aTerm) const -> Rank
+{
+    const auto& myExponents = aTerm.get();
+    ensure(
+        myExponents.size() == theColourNames.size(), "Expected {} exponents, but received {}",
+        theColourNames.size(), myExponents.size()
+    );
+    auto myRemaining = std::uint64_t{theDegree};
+    auto myRank = std::uint64_t{0};
+    for (auto myColour = 0uz; myColour + 1 < myExponents.size(); ++myColour)
+    {
+        ensure(
+            myExponents[myColour].get() <= myRemaining, "Expected exponents summing to {}",
+            theDegree
+        );
+        for (auto myValue = 0u; myValue < myExponents[myColour].get(); ++myValue)
+        {
+            myRank += *compositions(myRemaining - myValue, myExponents.size() - myColour - 1);
+        }
+        myRemaining -= myExponents[myColour].get();
+    }
+    ensure(
+        myExponents.back().get() == myRemaining, "Expected exponents summing to {}", theDegree
+    );
+    return Rank{myRank};
+}
+
+auto ColourCoefficients::begin() const -> Iterator
+{
+    return Iterator{*this, Rank{0}, Rank{size()}};
+}
+
+auto ColourCoefficients::end() const -> std::default_sentinel_t
+{
+    return std::default_sentinel;
+}
+
+auto ColourCoefficients::range(Rank aBegin, Rank anEnd) const -> Range
+{
+    ensure(
+        aBegin.get() <= anEnd.get() and anEnd.get() <= size(),
+        "Expected a range within [0, {}), but received [{}, {})", size(), aBegin.get(),
+        anEnd.get()
+    );
+    return Range{this, aBegin, anEnd};
+}
+
+auto ColourCoefficients::forEachChunk(
+    std::uint64_t aGrain, const std::function<void(const Range&)>& aBody,
+    const ExecutionContext& aContext, ThreadPool& aPool
+) const -> void
+{
+    const auto myTimer = stats::ScopedTimer{stats::Phase::ColourEvaluation};
+    const auto mySize = size();
+    auto myProcessed = std::atomic<std::uint64_t>{0};
+    parallelFor(
+        0uz, mySize, aGrain,
+        [&](std::size_t aBegin, std::size_t anEnd)
+        {
+            aContext.checkpoint(stats::Phase::ColourEvaluation, myProcessed.load(), mySize);
+            const auto mySpan = trace::Span{"colour coefficients"};
+            aBody(Range{this, Rank{aBegin}, Rank{anEnd}});
+            myProcessed.fetch_add(anEnd - aBegin);
+        },
+        aPool
+    );
+}
+
+auto ColourCoefficients::coefficient(
+    const std::vector<Exponent>& anExponents, std::vector<std::uint32_t>& aScratch
+) const -> Rational
+{
+    auto myResult = Rational{0};
+    for (const auto& myTerm : theTerms)
+    {
+        auto myColourings = std::int64_t{1};
+        if (anExponents.size() > 1)
+        {
+            aScratch = myTerm.theMultiplicities;
+            myColourings = colourings(myTerm, aScratch, anExponents, 0, anExponents[0].get(), 0);
+        }
+        if (myColourings != 0)
+        {
+            myResult += myTerm.theCoefficient * Rational{myColourings};
+        }
+    }
+    return myResult;
+}
+
+// Ways to give the cycles in aRemaining to colours aColour, ..., K - 1 so that colour j covers
+// anExponents[j] points, with aTarget points of aColour left to cover from part aPart on. The
+// last colour takes whatever is left.
+auto ColourCoefficients::colourings(
+    const CycleTerm& aTerm, std::vector<std::uint32_t>& aRemaining,
+    const std::vector<Exponent>& anExponents, std::size_t aColour, std::uint32_t aTarget,
+    std::size_t aPart
+) const -> std::int64_t
+{
+    if (aTarget == 0)
+    {
+        return aColour + 2 == anExponents.size()
+                   ? 1
+                   : colourings(
+                         aTerm, aRemaining, anExponents, aColour + 1,
+                         anExponents[aColour + 1].get(), 0
+                     );
+    }
+    if (aPart == aTerm.theLengths.size())
+    {
+        return 0;
+    }
+
+    const auto myLength = aTerm.theLengths[aPart];
+    const auto myMultiplicity = aRemaining[aPart];
+    auto myResult = std::int64_t{0};
+    for (auto myTaken = 0u; myTaken <= std::min(myMultiplicity, aTarget / myLength); ++myTaken)
+    {
+        aRemaining[aPart] = myMultiplicity - myTaken;
+        const auto myRest = colourings(
+            aTerm, aRemaining, anExponents, aColour, aTarget - myTaken * myLength, aPart + 1
+        );
+        if (myRest != 0)
+        {
+            myResult = checkedAdd(
+                myResult, checkedMultiply(binomial(myMultiplicity, myTaken), myRest)
+            );
+        }
+    }
+    aRemaining[aPart] = myMultiplicity;
+    return myResult;
+}
+
+auto ColourCoefficients::binomial(std::uint32_t aTop, std::uint32_t aBottom) const
+    -> std::int64_t
+{
+    return theBinomials[aTop][aBottom];
+}
+
+ColourCoefficients::Iterator::Iterator(
+    const ColourCoefficients& aCoefficients, Rank aBegin, Rank anEnd
+)
+    : theCoefficients{&aCoefficients}, theRank{aBegin.get()}, theEnd{anEnd.get()}
+{
+    if (theRank < theEnd)
+    {
+        theEntry.theTerm = aCoefficients.term(aBegin);
+        theEntry.theCoefficient = aCoefficients.coefficient(theEntry.theTerm.get(), theScratch);
+    }
+}
+
+auto ColourCoefficients::Iterator::operator*() const -> const Entry&
+{
+    return theEntry;
+}
+
+auto ColourCoefficients::Iterator::operator->() const -> const Entry*
+{
+    return &theEntry;
+}
+
+auto ColourCoefficients::Iterator::operator++() -> Iterator&
+{
+    if (++theRank < theEnd)
+    {
+        advance(theEntry.theTerm.get());
+        theEntry.theCoefficient =
+            theCoefficients->coefficient(theEntry.theTerm.get(), theScratch);
+    }
+    return *this;
+}
+
+auto ColourCoefficients::Iterator::operator++(int) -> void
+{
+    ++*this;
+}
+
+auto ColourCoefficients::Iterator::rank() const -> Rank
+{
+    return Rank{theRank};
+}
+
+auto ColourCoefficients::Iterator::operator==(std::default_sentinel_t) const -> bool
+{
+    return theRank >= theEnd;
+}
+
+auto ColourCoefficients::Range::begin() const -> Iterator
+{
+    return Iterator{*theCoefficients, theBegin, theEnd};
+}
+
+auto ColourCoefficients::Range::end() const -> std::default_sentinel_t
+{
+    return std::default_sentinel;
+}
+} // namespace polya
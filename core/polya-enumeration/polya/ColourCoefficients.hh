@@ -0,0 +1,129 @@
+#pragma once
+
+#include "core/polya-enumeration/cycle-index/CycleIndexPolynomial.hh"
+#include "core/polya-enumeration/orbit-counting/OrbitCounting.hh"
+#include "core/polya-enumeration/polynomial/Polynomial.hh"
+#include "core/polya-enumeration/rational/Rational.hh"
+#include "core/util/ExecutionContext.hh"
+#include "core/util/ThreadPool.hh"
+#include "core/util/Type.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+namespace polya
+{
+// The terms of evaluateColours(aCycleIndex, aColourCount) without the Polynomial. Each
+// coefficient is computed from the cycle index when its exponent vector is reached, so iterating
+// holds one term at a time however many colours there are. Exponent vectors are the weak
+// compositions of the degree into K parts, visited in the order of Polynomial::terms() and
+// numbered from 0 by their rank in that order.
+class ColourCoefficients
+{
+public:
+    using Rank = Type<std::uint64_t, struct RankTag>;
+
+    struct Entry
+    {
+        Polynomial::Term theTerm;
+        Rational theCoefficient;
+    };
+
+    class Iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+
+        [[nodiscard]] auto operator*() const -> const Entry&;
+        [[nodiscard]] auto operator->() const -> const Entry*;
+        auto operator++() -> Iterator&;
+        auto operator++(int) -> void;
+
+        [[nodiscard]] auto rank() const -> Rank;
+        [[nodiscard]] auto operator==(std::default_sentinel_t) const -> bool;
+
+    private:
+        friend class ColourCoefficients;
+        Iterator(const ColourCoefficients& aCoefficients, Rank aBegin, Rank anEnd);
+
+        const ColourCoefficients* theCoefficients = nullptr;
+        std::uint64_t theRank = 0;
+        std::uint64_t theEnd = 0;
+        std::vector<std::uint32_t> theScratch; // Multiplicities left while counting colourings
+        Entry theEntry{Polynomial::Term{{}}, Rational{0}};
+    };
+
+    // Terms [theBegin, theEnd) in rank order
+    struct Range
+    {
+        const ColourCoefficients* theCoefficients;
+        Rank theBegin;
+        Rank theEnd;
+
+        [[nodiscard]] auto begin() const -> Iterator;
+        [[nodiscard]] auto end() const -> std::default_sentinel_t;
+    };
+
+    ColourCoefficients(
+        const CycleIndexPolynomial& aCycleIndex,
+        orbits::ColourCount aColourCount,
+        const std::optional<std::vector<Polynomial::VariableName>>& aColourNames = std::nullopt
+    );
+
+    [[nodiscard]] auto variables() const -> const std::vector<Polynomial::VariableName>&;
+    [[nodiscard]] auto size() const -> std::uint64_t; // C(n + K - 1, K - 1), throws if too many
+
+    // Zero for terms of the wrong length or total degree
+    [[nodiscard]] auto coefficient(const Polynomial::Term& aTerm) const -> Rational;
+    [[nodiscard]] auto term(Rank aRank) const -> Polynomial::Term;
+    [[nodiscard]] auto rank(const Polynomial::Term& aTerm) const -> Rank;
+
+    [[nodiscard]] auto begin() const -> Iterator;
+    [[nodiscard]] auto end() const -> std::default_sentinel_t;
+    [[nodiscard]] auto range(Rank aBegin, Rank anEnd) const -> Range;
+
+    // Calls aBody on consecutive ranges of aGrain terms from the pool's workers, in any order.
+    // Throws Interrupted if aContext stops it between ranges.
+    auto forEachChunk(
+        std::uint64_t aGrain,
+        const std::function<void(const Range&)>& aBody,
+        const ExecutionContext& aContext = ExecutionContext::unlimited(),
+        ThreadPool& aPool = ThreadPool::shared()
+    ) const -> void;
+
+private:
+    // A cycle index term as parallel arrays of cycle lengths and multiplicities
+    struct CycleTerm
+    {
+        std::vector<std::uint32_t> theLengths;
+        std::vector<std::uint32_t> theMultiplicities;
+        Rational theCoefficient;
+    };
+
+    [[nodiscard]] auto coefficient(
+        const std::vector<Polynomial::Exponent>& anExponents, std::vector<std::uint32_t>& aScratch
+    ) const -> Rational;
+    [[nodiscard]] auto colourings(
+        const CycleTerm& aTerm,
+        std::vector<std::uint32_t>& aRemaining,
+        const std::vector<Polynomial::Exponent>& anExponents,
+        std::size_t aColour,
+        std::uint32_t aTarget,
+        std::size_t aPart
+    ) const -> std::int64_t;
+    [[nodiscard]] auto binomial(std::uint32_t aTop, std::uint32_t aBottom) const -> std::int64_t;
+
+    std::uint32_t theDegree;
+    std::vector<Polynomial::VariableName> theColourNames;
+    std::vector<CycleTerm> theTerms;
+    std::vector<std::vector<std::int64_t>> theBinomials; // Up to the largest multiplicity
+};
+} // namespace polya
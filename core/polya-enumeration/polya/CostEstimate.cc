@@ -0,0 +1,214 @@
+#include "core/polya-enumeration/polya/CostEstimate.hh"
+
+#include "core/polya-enumeration/polya/ExpansionGrain.hh"
+#include "core/util/Exception.hh"
+#include "core/util/ThreadPool.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace polya
+{
+namespace
+{
+// Fitted to the groups of BM_CycleIndexPolynomial and BM_EvaluateColours with POLYA_THREADS=1;
+// predictions are within a factor of 2.5 of the measured times. Evaluation costs grow with the
+// square of the colour count, as products compare and copy exponent vectors of length K while
+// the number of power sum terms to multiply also grows with K.
+constexpr auto theNanosecondsPerPoint = 8.3;    // Cycle type of an element, per point
+constexpr auto theNanosecondsPerElement = 360.0; // Histogram update and chunking, per element
+constexpr auto theNanosecondsPerProduct = 16.3;  // A term product, per colour squared
+constexpr auto theNanosecondsPerTerm = 1070.0;   // Power sums of a term, per colour squared
+
+// Container layouts on 64 bit libstdc++ with a 16 byte malloc header per allocation
+constexpr auto theAllocationBytes = 16.0;
+constexpr auto theMapNodeBytes = 32.0 + theAllocationBytes; // Red-black links and colour
+constexpr auto theVectorBytes = 24.0;
+constexpr auto theRationalBytes = 16.0;
+constexpr auto theCycleTypePartBytes = 8.0;
+
+// p(k) > 2^64 for k >= 417, so no group has enough elements to need larger partitions
+constexpr auto thePartitionLimit = 512uz;
+
+auto saturate(double aValue) -> std::uint64_t
+{
+    constexpr auto myMaximum = static_cast<double>(std::numeric_limits<std::uint64_t>::max());
+    return aValue >= myMaximum ? std::numeric_limits<std::uint64_t>::max()
+                               : static_cast<std::uint64_t>(std::llround(aValue));
+}
+
+auto saturateTime(double aNanoseconds) -> std::chrono::nanoseconds
+{
+    constexpr auto myMaximum =
+        static_cast<double>(std::numeric_limits<std::chrono::nanoseconds::rep>::max());
+    return std::chrono::nanoseconds{
+        aNanoseconds >= myMaximum ? std::numeric_limits<std::chrono::nanoseconds::rep>::max()
+                                  : static_cast<std::chrono::nanoseconds::rep>(aNanoseconds)};
+}
+
+auto binomial(double aTop, double aBottom) -> double
+{
+    return std::round(std::exp(
+        std::lgamma(aTop + 1) - std::lgamma(aBottom + 1) - std::lgamma(aTop - aBottom + 1)
+    ));
+}
+
+// Allocation of a vector's elements, rounded up to malloc's 16 byte granularity
+auto arrayBytes(double aBytes) -> double
+{
+    return std::ceil(aBytes / 16) * 16 + theAllocationBytes;
+}
+
+// theTable[k][j] is the number of partitions of k into parts of size at most j <= k
+auto partitionTable() -> const std::vector<std::vector<double>>&
+{
+    static const auto theTable = []
+    {
+        auto myTable = std::vector<std::vector<double>>(thePartitionLimit);
+        myTable[0] = {1.0};
+        for (auto myTotal = 1uz; myTotal < thePartitionLimit; ++myTotal)
+        {
+            auto& myRow = myTable[myTotal];
+            myRow.assign(myTotal + 1, 0.0);
+            for (auto myLargest = 1uz; myLargest <= myTotal; ++myLargest)
+            {
+                const auto& myRest = myTable[myTotal - myLargest];
+                myRow[myLargest] =
+                    myRow[myLargest - 1] + myRest[std::min(myLargest, myTotal - myLargest)];
+            }
+        }
+        return myTable;
+    }();
+    return theTable;
+}
+
+// Partitions of aDegree into exactly aCycles parts, i.e. the cycle types with that many cycles
+auto cycleTypesWithCycles(std::size_t aDegree, std::size_t aCycles) -> double
+{
+    const auto myRest = aDegree - aCycles; // Partitions of the rest into at most aCycles parts
+    if (myRest >= thePartitionLimit)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+    return partitionTable()[myRest][std::min(aCycles, myRest)];
+}
+
+// Partitions of aDegree into at most aParts parts, the same as into parts of size at most aParts
+auto partitionsWithParts(std::size_t aDegree, std::size_t aParts) -> double
+{
+    if (aDegree >= thePartitionLimit)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+    return partitionTable()[aDegree][std::min(aParts, aDegree)];
+}
+} // namespace
+
+auto CostEstimate::peakBytes() const -> std::uint64_t
+{
+    return saturate(
+        static_cast<double>(theGroupBytes) + static_cast<double>(theCycleIndexBytes)
+        + static_cast<double>(theEvaluationBytes)
+    );
+}
+
+auto CostEstimate::toString() const -> std::string
+{
+    return "order " + std::to_string(theGroupOrder) + ", " + std::to_string(theCycleIndexTerms)
+           + " cycle index terms, " + std::to_string(theOutputTerms) + " output terms, peak "
+           + std::to_string(peakBytes()) + " bytes, cycle index "
+           + std::to_string(theCycleIndexTime.count()) + "ns, evaluation "
+           + std::to_string(theEvaluationTime.count()) + "ns";
+}
+
+auto operator<<(std::ostream& aStream, const CostEstimate& anEstimate) -> std::ostream&
+{
+    return aStream << anEstimate.toString();
+}
+
+auto estimateGroupBytes(Permutation::Degree aDegree, std::uint64_t aGroupOrder) -> std::uint64_t
+{
+    // Generation holds the elements in a set and then copies them into a vector
+    const auto myElementBytes =
+        theVectorBytes + arrayBytes(4 * static_cast<double>(aDegree.get()));
+    return saturate(static_cast<double>(aGroupOrder) * (2 * myElementBytes + theMapNodeBytes));
+}
+
+auto estimateCost(
+    Permutation::Degree aDegree, std::uint64_t aGroupOrder, orbits::ColourCount aColourCount
+) -> CostEstimate
+{
+    ensure(aDegree.get() > 0, "Expected a non zero degree");
+    ensure(aGroupOrder > 0, "Expected a non zero group order");
+    ensure(aColourCount.get() > 0, "Expected a non zero colour count");
+    const auto myDegree = static_cast<double>(aDegree.get());
+    const auto myOrder = static_cast<double>(aGroupOrder);
+    const auto myColours = static_cast<double>(aColourCount.get());
+
+    // The costliest cycle types have the most cycles, so take the types with the most cycles
+    // until the group runs out of elements. The expansion of a type with m cycles forms
+    // K * C(m + K - 1, K) term products and adds C(m + K - 1, K - 1) terms to its partial sum.
+    auto myTerms = 0.0;
+    auto myProducts = 0.0;
+    for (auto myCycles = aDegree.get(); myCycles > 0 and myTerms < myOrder; --myCycles)
+    {
+        const auto myCount =
+            std::min(cycleTypesWithCycles(aDegree.get(), myCycles), myOrder - myTerms);
+        const auto myCyclesReal = static_cast<double>(myCycles);
+        myTerms += myCount;
+        myProducts += myCount
+                      * (myColours * binomial(myCyclesReal + myColours - 1, myColours)
+                         + binomial(myCyclesReal + myColours - 1, myColours - 1));
+    }
+
+    // Distinct cycle lengths sum to at most n, so a cycle type has at most sqrt(2n) parts
+    const auto myMostParts = std::min(myDegree, std::ceil(std::sqrt(2 * myDegree)));
+    const auto myOutputTerms = binomial(myDegree + myColours - 1, myColours - 1);
+    const auto myTermBytes =
+        theMapNodeBytes + theVectorBytes + theRationalBytes + arrayBytes(4 * myColours);
+    const auto myCycleIndexTermBytes =
+        theMapNodeBytes + theVectorBytes + theRationalBytes
+        + arrayBytes(theCycleTypePartBytes * myMostParts);
+
+    const auto myWorkers = static_cast<double>(ThreadPool::shared().workerCount());
+    // evaluateColours holds one partial sum per task, with the tasks sized as in Polya.cc
+    const auto myPartialSums = std::min(
+        std::ceil(myTerms / static_cast<double>(detail::theExpansionGrain)),
+        static_cast<double>(detail::thePartialSumsPerWorker) * myWorkers
+    );
+    const auto myProductsInFlight = std::min(myWorkers, myTerms);
+    const auto myEvaluationBytes =
+        myOutputTerms * myTermBytes * (1 + myPartialSums + myProductsInFlight);
+
+    const auto mySymmetricTerms = partitionsWithParts(aDegree.get(), aColourCount.get());
+    const auto mySymmetricBytes =
+        mySymmetricTerms
+        * (myTermBytes + theVectorBytes + arrayBytes(4 * myColours) + theRationalBytes);
+
+    return CostEstimate{
+        .theGroupOrder = aGroupOrder,
+        .theCycleIndexTerms = saturate(myTerms),
+        .theOutputTerms = saturate(myOutputTerms),
+        .theGroupBytes = estimateGroupBytes(aDegree, aGroupOrder),
+        .theCycleIndexBytes = saturate(myTerms * myCycleIndexTermBytes),
+        .theEvaluationBytes = saturate(myEvaluationBytes),
+        .theSymmetricTerms = saturate(mySymmetricTerms),
+        .theSymmetricBytes = saturate(mySymmetricBytes),
+        .theCycleIndexTime = saturateTime(
+            myOrder * (myDegree * theNanosecondsPerPoint + theNanosecondsPerElement)
+        ),
+        .theEvaluationTime = saturateTime(
+            (myProducts * theNanosecondsPerProduct + myTerms * theNanosecondsPerTerm) * myColours
+            * myColours
+        ),
+    };
+}
+
+auto estimateCost(const PermutationGroup& aGroup, orbits::ColourCount aColourCount)
+    -> CostEstimate
+{
+    return estimateCost(aGroup.degree(), aGroup.order().get(), aColourCount);
+}
+} // namespace polya
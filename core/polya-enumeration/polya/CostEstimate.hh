@@ -0,0 +1,50 @@
+#pragma once
+
+#include "core/polya-enumeration/group/PermutationGroup.hh"
+#include "core/polya-enumeration/orbit-counting/OrbitCounting.hh"
+#include "core/polya-enumeration/permutation/Permutation.hh"
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace polya
+{
+// Predicted resources of group generation, cycleIndexPolynomial and evaluateColours, for
+// admission control before running them. Term counts and memory are upper bounds; times are work
+// summed over all threads, calibrated against //core/bench on an optimised build. Every value
+// saturates at the maximum of its type.
+struct CostEstimate
+{
+    std::uint64_t theGroupOrder;
+    std::uint64_t theCycleIndexTerms; // At most the order and the partitions of the degree
+    std::uint64_t theOutputTerms;     // Colour monomials, C(n + K - 1, K - 1)
+    std::uint64_t theGroupBytes;      // Peak while generating the group
+    std::uint64_t theCycleIndexBytes;
+    std::uint64_t theEvaluationBytes; // Result, partial sums and products in flight
+    std::uint64_t theSymmetricTerms;  // Of evaluateSymmetricColours, partitions into <= K parts
+    std::uint64_t theSymmetricBytes;  // Result, partitions and their coefficients
+    std::chrono::nanoseconds theCycleIndexTime;
+    std::chrono::nanoseconds theEvaluationTime;
+
+    [[nodiscard]] auto peakBytes() const -> std::uint64_t; // Of the whole pipeline
+
+    [[nodiscard]] auto toString() const -> std::string;
+    friend auto operator<<(std::ostream& aStream, const CostEstimate& anEstimate)
+        -> std::ostream&;
+};
+
+// theGroupBytes alone, which does not depend on the colours. Linear in the order, so the bytes
+// per element are estimateGroupBytes(aDegree, 1).
+[[nodiscard]] auto estimateGroupBytes(Permutation::Degree aDegree, std::uint64_t aGroupOrder)
+    -> std::uint64_t;
+
+// For a group that has not been generated yet, e.g. GroupCatalog::order(...)
+[[nodiscard]] auto estimateCost(
+    Permutation::Degree aDegree, std::uint64_t aGroupOrder, orbits::ColourCount aColourCount
+) -> CostEstimate;
+
+[[nodiscard]] auto estimateCost(const PermutationGroup& aGroup, orbits::ColourCount aColourCount)
+    -> CostEstimate;
+} // namespace polya
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstddef>
+
+// Internal to the polya library, shared by the evaluation and its cost estimate
+namespace polya::detail
+{
+// Cycle index terms expanded per task, raised for large cycle indices so that at most this many
+// partial sums per worker are held until they are added up
+constexpr auto theExpansionGrain = 4uz;
+constexpr auto thePartialSumsPerWorker = 4uz;
+} // namespace polya::detail
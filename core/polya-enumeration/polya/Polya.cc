@@ -1,11 +1,22 @@
 #include "core/polya-enumeration/polya/Polya.hh"
 
+#include "core/polya-enumeration/polya/ColourCoefficients.hh"
+#include "core/polya-enumeration/polya/ExpansionGrain.hh"
 #include "core/util/Exception.hh"
 #include "core/util/Power.hh"
+#include "core/util/Stats.hh"
+#include "core/util/ThreadPool.hh"
+#include "core/util/Trace.hh"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <limits>
+#include <map>
 #include <range/v3/all.hpp>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 namespace polya
@@ -26,53 +37,148 @@ auto generatingFunction(
         auto myExponents =
             std::vector<Polynomial::Exponent>(myColourCount, Polynomial::Exponent{0});
         myExponents[myColour] = aPower;
-        myResult.set(Polynomial::Term{std::move(myExponents)}, Rational{1});
+        myResult.setUnchecked(Polynomial::Term{std::move(myExponents)}, Rational{1});
     }
 
     return myResult;
 }
+
+// Substitutes the colour power sums into one term of the cycle index
+auto expandTerm(
+    const std::vector<Polynomial::VariableName>& aColourVariables, const CycleType& aCycleType,
+    const Rational& aCoefficient, const ExecutionContext& aContext, const Polynomial::Caps& aCaps
+) -> Polynomial
+{
+    const auto mySpan = trace::Span{"expand term"};
+    auto myProduct = Polynomial{aColourVariables};
+    myProduct.setUnchecked(
+        Polynomial::Term{
+            std::vector<Polynomial::Exponent>(aColourVariables.size(), Polynomial::Exponent{0})},
+        aCoefficient
+    );
+
+    for (const auto& [myCycleLength, myMultiplicity] : aCycleType.parts())
+    {
+        auto myPowerSum =
+            generatingFunction(aColourVariables, Polynomial::Exponent{myCycleLength.get()});
+        myPowerSum.truncate(aCaps);
+
+        for ([[maybe_unused]] const auto myPowerIndex : views::iota(0uz, myMultiplicity.get()))
+        {
+            myProduct.multiply(myPowerSum, aCaps, aContext);
+        }
+    }
+    return myProduct;
+}
+
+using CycleTypeHistogram = std::unordered_map<CycleType, std::uint64_t, CycleType::Hash>;
+
+// Elements per task; smaller chunks cost more to schedule and merge than they save
+constexpr auto theHistogramGrain = 4096uz;
+
+// Partitions per task of evaluateSymmetricColours, each a search over every cycle index term
+constexpr auto thePartitionGrain = 8uz;
+
+auto cycleTypeHistogram(std::span<const Permutation> anElements) -> CycleTypeHistogram
+{
+    const auto mySpan = trace::Span{"cycle type histogram"};
+    auto myHistogram = CycleTypeHistogram{};
+    for (const auto& myElement : anElements)
+    {
+        ++myHistogram[myElement.cycleType()];
+    }
+    return myHistogram;
+}
+
+// Counts the cycle types of contiguous chunks of the elements on the shared thread pool, merging
+// the chunk histograms at the end
+auto parallelCycleTypeHistogram(
+    std::span<const Permutation> anElements, const ExecutionContext& aContext
+) -> CycleTypeHistogram
+{
+    auto myProcessed = std::atomic<std::size_t>{0};
+    return parallelReduce(
+        0uz, anElements.size(), theHistogramGrain, CycleTypeHistogram{},
+        [&](std::size_t aBegin, std::size_t anEnd)
+        {
+            aContext.checkpoint(stats::Phase::CycleIndex, myProcessed.load(), anElements.size());
+            auto myHistogram = cycleTypeHistogram(anElements.subspan(aBegin, anEnd - aBegin));
+            myProcessed.fetch_add(anEnd - aBegin);
+            return myHistogram;
+        },
+        [](CycleTypeHistogram&& aResult, CycleTypeHistogram&& aHistogram)
+        {
+            if (aResult.empty())
+            {
+                return std::move(aHistogram);
+            }
+            const auto mySpan = trace::Span{"merge histograms"};
+            for (const auto& [myCycleType, myCount] : aHistogram)
+            {
+                aResult[myCycleType] += myCount;
+            }
+            return std::move(aResult);
+        }
+    );
+}
+
+// Appends the partitions that complete aParts[0, anIndex) with parts of at most aLargest summing
+// to aRest
+auto extendPartitions(
+    std::vector<Polynomial::Exponent>& aParts, std::size_t anIndex, std::uint32_t aRest,
+    std::uint32_t aLargest, std::vector<Polynomial::Term>& aPartitions
+) -> void
+{
+    if (aRest == 0)
+    {
+        std::fill(aParts.begin() + anIndex, aParts.end(), Polynomial::Exponent{0});
+        aPartitions.emplace_back(aParts);
+        return;
+    }
+    if (anIndex == aParts.size())
+    {
+        return;
+    }
+    for (auto myPart = std::min(aRest, aLargest); myPart > 0; --myPart)
+    {
+        aParts[anIndex] = Polynomial::Exponent{myPart};
+        extendPartitions(aParts, anIndex + 1, aRest - myPart, myPart, aPartitions);
+    }
+}
+
+// The partitions of aTotal into at most aCount parts, as non-increasing exponent vectors padded
+// with zeros to aCount
+auto partitions(std::uint32_t aTotal, std::size_t aCount) -> std::vector<Polynomial::Term>
+{
+    auto myPartitions = std::vector<Polynomial::Term>{};
+    auto myParts = std::vector<Polynomial::Exponent>(aCount, Polynomial::Exponent{0});
+    extendPartitions(myParts, 0, aTotal, aTotal, myPartitions);
+    return myPartitions;
+}
 } // namespace
 
 auto cycleIndexPolynomial(
     const PermutationGroup& aGroup,
-    const std::optional<std::vector<Polynomial::VariableName>>& aVariableNames
+    const std::optional<std::vector<Polynomial::VariableName>>& aVariableNames,
+    const ExecutionContext& aContext
 ) -> CycleIndexPolynomial
 {
-    const auto myDegreeValue = aGroup.degree().get();
-    auto myVariableNames = aVariableNames.value_or(
-        views::iota(1uz, myDegreeValue + 1)
-        | views::transform([](const auto& aValue)
-                           { return Polynomial::VariableName{"x_" + std::to_string(aValue)}; })
-        | ranges::to<std::vector<Polynomial::VariableName>>()
-    );
-    ensure(
-        myVariableNames.size() == myDegreeValue,
-        "Expected the number of variable names ({}) to match the degree ({})",
-        myVariableNames.size(), myDegreeValue
-    );
-
-    auto myPolynomial = Polynomial(myVariableNames);
-    const auto myGroupFactor = Rational{
-        Rational::Numerator{1},
-        Rational::Denominator{static_cast<std::int64_t>(aGroup.order().get())}};
+    const auto myTimer = stats::ScopedTimer{stats::Phase::CycleIndex};
+    const auto mySpan = trace::Span{"cycle index"};
+    auto myCycleIndex = CycleIndexPolynomial{aGroup.degree(), aVariableNames};
+    const auto myGroupOrder = static_cast<std::int64_t>(aGroup.order().get());
 
-    for (const auto& myElement : aGroup.elements().get())
+    // Exact integer counts per cycle type, divided by |G| once per distinct type
+    const auto myHistogram = parallelCycleTypeHistogram(aGroup.elements().get(), aContext);
+    for (const auto& [myCycleType, myCount] : myHistogram)
     {
-        const auto& myDistribution = myElement.cycleStructure().theCycleLengthDistribution;
-        auto myExponents =
-            views::iota(1uz, myDegreeValue + 1)
-            | views::transform(
-                [&myDistribution](const auto& aLength)
-                {
-                    return Polynomial::Exponent{
-                        aLength < myDistribution.size() ? myDistribution.at(aLength).get() : 0uz};
-                }
-            )
-            | ranges::to<std::vector<Polynomial::Exponent>>();
-        const auto myTerm = Polynomial::Term{std::move(myExponents)};
-        myPolynomial.set(myTerm, myPolynomial.coefficient(myTerm) + myGroupFactor);
+        auto myCoefficient = Rational{
+            Rational::Numerator{static_cast<std::int64_t>(myCount)},
+            Rational::Denominator{myGroupOrder}};
+        myCoefficient.reduce();
+        myCycleIndex.set(myCycleType, myCoefficient);
     }
-    return CycleIndexPolynomial{myPolynomial};
+    return myCycleIndex;
 }
 
 auto evaluateUniform(const CycleIndexPolynomial& aCycleIndex, orbits::ColourCount aColourCount)
@@ -80,25 +186,39 @@ auto evaluateUniform(const CycleIndexPolynomial& aCycleIndex, orbits::ColourCoun
 {
     const auto substituteIntoTerm = [aColourCount](const auto& aPair)
     {
-        const auto& [myTerm, myCoefficient] = aPair;
-        const auto myExponent = mathutil::Exponent{ranges::accumulate(
-            myTerm.get() | views::transform(&Polynomial::Exponent::underlying), 0uz
-        )};
-        return myCoefficient
-               * Rational{mathutil::power(mathutil::Base{aColourCount.get()}, myExponent).get()};
+        const auto& [myCycleType, myCoefficient] = aPair;
+        const auto myExponent = mathutil::Exponent{myCycleType.cycleCount().get()};
+        const auto myPower = mathutil::power(mathutil::Base{aColourCount.get()}, myExponent);
+        ensure(
+            myPower.get() <= std::numeric_limits<std::int64_t>::max(),
+            "Expected {}^{} to fit in a Rational", aColourCount.get(), myExponent.get()
+        );
+        return myCoefficient * Rational{static_cast<std::int64_t>(myPower.get())};
     };
     const auto myResult = ranges::accumulate(
-        aCycleIndex.get().terms() | views::transform(substituteIntoTerm), Rational{0}
+        aCycleIndex.terms() | views::transform(substituteIntoTerm), Rational{0}
     );
     return orbits::OrbitCount{myResult.asInteger()};
 }
 
-auto evaluateColours(
-    const CycleIndexPolynomial& aCycleIndex, orbits::ColourCount aColourCount,
-    const std::optional<std::vector<Polynomial::VariableName>>& aColourNames
-) -> Polynomial
+auto evaluateUniform(const ModularCycleIndex& aCycleIndex, orbits::ColourCount aColourCount)
+    -> Modular
 {
+    const auto myColours =
+        Modular{static_cast<std::int64_t>(aColourCount.get()), aCycleIndex.zero().modulus()};
+    auto myResult = aCycleIndex.zero();
+    for (const auto& [myCycleType, myCoefficient] : aCycleIndex.terms())
+    {
+        myResult += myCoefficient * myColours.pow(myCycleType.cycleCount().get());
+    }
+    return myResult;
+}
 
+auto colourVariables(
+    orbits::ColourCount aColourCount,
+    const std::optional<std::vector<Polynomial::VariableName>>& aColourNames
+) -> std::vector<Polynomial::VariableName>
+{
     auto myColourVariables = aColourNames.value_or(
         views::iota(1uz, aColourCount.get() + 1)
         | views::transform([](const auto& aValue)
@@ -110,36 +230,199 @@ auto evaluateColours(
         "Expected the number of colour names ({}) to match the colour count ({})",
         myColourVariables.size(), aColourCount.get()
     );
+    return myColourVariables;
+}
+
+auto evaluateColours(
+    const CycleIndexPolynomial& aCycleIndex, orbits::ColourCount aColourCount,
+    const std::optional<std::vector<Polynomial::VariableName>>& aColourNames,
+    const ExecutionContext& aContext, const Polynomial::Caps& aCaps
+) -> Polynomial
+{
+    const auto myTimer = stats::ScopedTimer{stats::Phase::ColourEvaluation};
+    const auto mySpan = trace::Span{"evaluate colours"};
+
+    const auto myColourVariables = colourVariables(aColourCount, aColourNames);
 
-    auto myResult = Polynomial{myColourVariables};
+    const auto myTerms = aCycleIndex.terms()
+                         | views::transform([](const auto& aTerm) { return &aTerm; })
+                         | ranges::to<std::vector>();
+
+    // Terms are expanded independently on the shared thread pool and summed in term order
+    const auto myChunkLimit =
+        detail::thePartialSumsPerWorker * ThreadPool::shared().workerCount();
+    const auto myGrain =
+        std::max(detail::theExpansionGrain, (myTerms.size() + myChunkLimit - 1) / myChunkLimit);
+    auto myExpanded = std::atomic<std::size_t>{0};
+    return parallelReduce(
+        0uz, myTerms.size(), myGrain, Polynomial{myColourVariables},
+        [&](std::size_t aBegin, std::size_t anEnd)
+        {
+            auto mySum = Polynomial{myColourVariables};
+            for (const auto* myTerm : std::span{myTerms}.subspan(aBegin, anEnd - aBegin))
+            {
+                aContext.checkpoint(
+                    stats::Phase::ColourEvaluation, myExpanded.fetch_add(1), myTerms.size()
+                );
+                mySum += expandTerm(
+                    myColourVariables, myTerm->first, myTerm->second, aContext, aCaps
+                );
+            }
+            return mySum;
+        },
+        [](Polynomial&& aResult, Polynomial&& aSum)
+        {
+            aResult += aSum;
+            return std::move(aResult);
+        }
+    );
+}
 
-    for (const auto& [myTerm, myCoefficient] : aCycleIndex.get().terms())
+auto evaluateSymmetricColours(
+    const CycleIndexPolynomial& aCycleIndex, orbits::ColourCount aColourCount,
+    const std::optional<std::vector<Polynomial::VariableName>>& aColourNames,
+    const ExecutionContext& aContext
+) -> SymmetricPolynomial
+{
+    const auto myTimer = stats::ScopedTimer{stats::Phase::ColourEvaluation};
+    const auto mySpan = trace::Span{"evaluate symmetric colours"};
+    const auto myCoefficients = ColourCoefficients{aCycleIndex, aColourCount, aColourNames};
+    const auto myPartitions = partitions(
+        static_cast<std::uint32_t>(aCycleIndex.degree().get()), aColourCount.get()
+    );
+
+    // Each coefficient is computed directly from the cycle index, so partitions are independent
+    auto myValues = std::vector<Rational>(myPartitions.size(), Rational{0});
+    auto myProcessed = std::atomic<std::size_t>{0};
+    parallelFor(
+        0uz, myPartitions.size(), thePartitionGrain,
+        [&](std::size_t aBegin, std::size_t anEnd)
+        {
+            aContext.checkpoint(
+                stats::Phase::ColourEvaluation, myProcessed.load(), myPartitions.size()
+            );
+            for (auto myIndex = aBegin; myIndex < anEnd; ++myIndex)
+            {
+                myValues[myIndex] = myCoefficients.coefficient(myPartitions[myIndex]);
+            }
+            myProcessed.fetch_add(anEnd - aBegin);
+        }
+    );
+
+    auto myResult = SymmetricPolynomial{myCoefficients.variables()};
+    for (const auto& [myPartition, myValue] : views::zip(myPartitions, myValues))
     {
-        auto myProduct = Polynomial{myColourVariables};
-        myProduct.set(
-            Polynomial::Term{
-                std::vector<Polynomial::Exponent>(aColourCount.get(), Polynomial::Exponent{0})},
-            myCoefficient
-        );
+        myResult.set(myPartition, myValue);
+    }
+    return myResult;
+}
+
+namespace
+{
+template <typename Coefficient>
+auto substituteSeries(
+    const BasicCycleIndexPolynomial<Coefficient>& aCycleIndex,
+    const BasicPowerSeries<Coefficient>& aFigures, PowerSeries::Order anOrder,
+    const ExecutionContext& aContext
+) -> BasicPowerSeries<Coefficient>
+{
+    using Series = BasicPowerSeries<Coefficient>;
+    const auto myTimer = stats::ScopedTimer{stats::Phase::ColourEvaluation};
+    const auto mySpan = trace::Span{"evaluate series"};
+    const auto myFigures = Series{aFigures.coefficients(), anOrder, aFigures.zero()};
 
-        for (const auto myCycleLength : views::iota(1uz, myTerm.get().size() + 1))
+    // f(t^k) for every cycle length k that occurs, shared by all terms
+    auto mySubstitutions = std::map<std::uint32_t, Series>{};
+    for (const auto& myCycleType : aCycleIndex.terms() | views::keys)
+    {
+        for (const auto& myPart : myCycleType.parts())
         {
-            const auto myExponent = myTerm.get()[myCycleLength - 1];
-            if (myExponent == Polynomial::Exponent{0})
+            const auto myLength = myPart.theLength.get();
+            if (not mySubstitutions.contains(myLength))
             {
-                continue;
+                mySubstitutions.emplace(
+                    myLength, myFigures.substitutePower(typename Series::Power{myLength})
+                );
             }
-            const auto myPowerSum =
-                generatingFunction(myColourVariables, Polynomial::Exponent{myCycleLength});
+        }
+    }
 
-            for ([[maybe_unused]] const auto myPowerIndex : views::iota(0uz, myExponent.get()))
+    const auto myTerms = aCycleIndex.terms()
+                         | views::transform([](const auto& aTerm) { return &aTerm; })
+                         | ranges::to<std::vector>();
+    const auto myChunkLimit =
+        detail::thePartialSumsPerWorker * ThreadPool::shared().workerCount();
+    const auto myGrain =
+        std::max(detail::theExpansionGrain, (myTerms.size() + myChunkLimit - 1) / myChunkLimit);
+    auto mySubstituted = std::atomic<std::size_t>{0};
+    return parallelReduce(
+        0uz, myTerms.size(), myGrain, Series{anOrder, aFigures.zero()},
+        [&](std::size_t aBegin, std::size_t anEnd)
+        {
+            auto mySum = Series{anOrder, aFigures.zero()};
+            for (const auto* myTerm : std::span{myTerms}.subspan(aBegin, anEnd - aBegin))
             {
-                myProduct *= myPowerSum;
+                aContext.checkpoint(
+                    stats::Phase::ColourEvaluation, mySubstituted.fetch_add(1), myTerms.size()
+                );
+                auto myProduct = Series::one(anOrder, aFigures.zero());
+                for (const auto& myPart : myTerm->first.parts())
+                {
+                    myProduct *= mySubstitutions.at(myPart.theLength.get())
+                                     .pow(myPart.theMultiplicity.get());
+                }
+                mySum += myProduct * myTerm->second;
             }
+            return mySum;
+        },
+        [](Series&& aResult, Series&& aSum)
+        {
+            aResult += aSum;
+            return std::move(aResult);
         }
-        myResult += myProduct;
+    );
+}
+} // namespace
+
+auto evaluateSeries(
+    const CycleIndexPolynomial& aCycleIndex, const PowerSeries& aFigures,
+    PowerSeries::Order anOrder, const ExecutionContext& aContext
+) -> PowerSeries
+{
+    return substituteSeries(aCycleIndex, aFigures, anOrder, aContext);
+}
+
+auto evaluateSeries(
+    const ModularCycleIndex& aCycleIndex, const ModularPowerSeries& aFigures,
+    PowerSeries::Order anOrder, const ExecutionContext& aContext
+) -> ModularPowerSeries
+{
+    return substituteSeries(aCycleIndex, aFigures, anOrder, aContext);
+}
+
+auto tryCycleIndexPolynomial(
+    const PermutationGroup& aGroup,
+    const std::optional<std::vector<Polynomial::VariableName>>& aVariableNames
+) -> Expected<CycleIndexPolynomial>
+{
+    if (aVariableNames and aVariableNames->size() != aGroup.degree().get())
+    {
+        return std::unexpected{Error{
+            Error::Code::VariableCountMismatch, aVariableNames->size(), aGroup.degree().get()}};
     }
+    return cycleIndexPolynomial(aGroup, aVariableNames);
+}
 
-    return myResult;
+auto tryEvaluateColours(
+    const CycleIndexPolynomial& aCycleIndex, orbits::ColourCount aColourCount,
+    const std::optional<std::vector<Polynomial::VariableName>>& aColourNames
+) -> Expected<Polynomial>
+{
+    if (aColourNames and aColourNames->size() != aColourCount.get())
+    {
+        return std::unexpected{
+            Error{Error::Code::ColourCountMismatch, aColourNames->size(), aColourCount.get()}};
+    }
+    return evaluateColours(aCycleIndex, aColourCount, aColourNames);
 }
-} // namespace polya
\ No newline at end of file
+} // namespace polya
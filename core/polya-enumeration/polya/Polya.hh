@@ -1,31 +1,87 @@
 #pragma once
 
+#include "core/polya-enumeration/cycle-index/CycleIndexPolynomial.hh"
 #include "core/polya-enumeration/group/PermutationGroup.hh"
 #include "core/polya-enumeration/orbit-counting/OrbitCounting.hh"
 #include "core/polya-enumeration/polynomial/Polynomial.hh"
-#include "core/util/Type.hh"
+#include "core/polya-enumeration/polynomial/PowerSeries.hh"
+#include "core/polya-enumeration/polynomial/SymmetricPolynomial.hh"
+#include "core/util/Error.hh"
+#include "core/util/ExecutionContext.hh"
 
 #include <optional>
+#include <vector>
 
 namespace polya
 {
-using CycleIndexPolynomial = Type<Polynomial, struct CycleIndexPolynomialTag>;
-
-// Generate the cycle index polynomial
+// Generate the cycle index polynomial. Throws Interrupted if aContext stops it.
 auto cycleIndexPolynomial(
     const PermutationGroup& aGroup,
-    const std::optional<std::vector<Polynomial::VariableName>>& aVariableNames = std::nullopt
+    const std::optional<std::vector<Polynomial::VariableName>>& aVariableNames = std::nullopt,
+    const ExecutionContext& aContext = ExecutionContext::unlimited()
 ) -> CycleIndexPolynomial;
 
 // Evaluate the polynomial at a constant (equivalent to Orbit Counting)
 auto evaluateUniform(const CycleIndexPolynomial& aCycleIndex, orbits::ColourCount aColourCount)
     -> orbits::OrbitCount;
 
-// Polya Enumeration Theorem
+// The orbit count modulo the modulus of aCycleIndex, for counts past 64 bits
+auto evaluateUniform(const ModularCycleIndex& aCycleIndex, orbits::ColourCount aColourCount)
+    -> Modular;
+
+// aColourNames, or c_1, ..., c_K, checking that there are aColourCount of them
+auto colourVariables(
+    orbits::ColourCount aColourCount,
+    const std::optional<std::vector<Polynomial::VariableName>>& aColourNames = std::nullopt
+) -> std::vector<Polynomial::VariableName>;
+
+// Polya Enumeration Theorem. Throws Interrupted if aContext stops it. Terms that aCaps does not
+// admit, e.g. more than two of the first colour, are dropped while the power sums are multiplied.
 auto evaluateColours(
     const CycleIndexPolynomial& aCycleIndex,
     orbits::ColourCount aColourCount,
-    const std::optional<std::vector<Polynomial::VariableName>>& aColourNames = std::nullopt
+    const std::optional<std::vector<Polynomial::VariableName>>& aColourNames = std::nullopt,
+    const ExecutionContext& aContext = ExecutionContext::unlimited(),
+    const Polynomial::Caps& aCaps = {}
 ) -> Polynomial;
 
+// evaluateColours computing only the non-increasing exponent vectors, i.e. the partitions of
+// the degree into at most K parts, as every permutation of them has the same coefficient
+auto evaluateSymmetricColours(
+    const CycleIndexPolynomial& aCycleIndex,
+    orbits::ColourCount aColourCount,
+    const std::optional<std::vector<Polynomial::VariableName>>& aColourNames = std::nullopt,
+    const ExecutionContext& aContext = ExecutionContext::unlimited()
+) -> SymmetricPolynomial;
+
+// Polya's theorem with a figure counting series f(t) = f_0 + f_1 t + ..., where f_w counts the
+// figures of weight w: Z(f(t), f(t^2), ..., f(t^n)) up to t^(anOrder - 1), whose t^w coefficient
+// counts the orbits of total weight w. Throws Interrupted if aContext stops it.
+auto evaluateSeries(
+    const CycleIndexPolynomial& aCycleIndex,
+    const PowerSeries& aFigures,
+    PowerSeries::Order anOrder,
+    const ExecutionContext& aContext = ExecutionContext::unlimited()
+) -> PowerSeries;
+
+// The same modulo the modulus of aCycleIndex, which aFigures must share
+auto evaluateSeries(
+    const ModularCycleIndex& aCycleIndex,
+    const ModularPowerSeries& aFigures,
+    PowerSeries::Order anOrder,
+    const ExecutionContext& aContext = ExecutionContext::unlimited()
+) -> ModularPowerSeries;
+
+// Non-throwing alternatives for untrusted input; validation failures are returned as errors
+auto tryCycleIndexPolynomial(
+    const PermutationGroup& aGroup,
+    const std::optional<std::vector<Polynomial::VariableName>>& aVariableNames = std::nullopt
+) -> Expected<CycleIndexPolynomial>;
+
+auto tryEvaluateColours(
+    const CycleIndexPolynomial& aCycleIndex,
+    orbits::ColourCount aColourCount,
+    const std::optional<std::vector<Polynomial::VariableName>>& aColourNames = std::nullopt
+) -> Expected<Polynomial>;
+
 } // namespace polya
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include "core/polya-enumeration/polya/Async.hh"
+#include "core/polya-enumeration/group/PermutationGroup.hh"
+#include "core/polya-enumeration/polya/Polya.hh"
+#include "core/util/ThreadPool.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <future>
+#include <latch>
+#include <memory>
+#include <vector>
+
+namespace polya::test
+{
+using namespace ::testing;
+using ColourCount = orbits::ColourCount;
+using Degree = Permutation::Degree;
+
+class AsyncTest : public ::testing::Test
+{
+};
+
+TEST_F(AsyncTest, JobsMatchSynchronousResults)
+{
+    auto myJobs = std::vector<async::Job<Polynomial>>{};
+    for (auto myDegree = 1uz; myDegree <= 8; ++myDegree)
+    {
+        myJobs.push_back(async::evaluateColours(
+            cycleIndexPolynomial(groups::dihedral(Degree{myDegree})), ColourCount{3}
+        ));
+    }
+    for (auto myDegree = 1uz; myDegree <= 8; ++myDegree)
+    {
+        const auto myCycleIndex = cycleIndexPolynomial(groups::dihedral(Degree{myDegree}));
+        const auto myExpected = evaluateColours(myCycleIndex, ColourCount{3});
+        EXPECT_THAT(myJobs[myDegree - 1].get(), Eq(myExpected));
+    }
+}
+
+TEST_F(AsyncTest, CycleIndexJob)
+{
+    auto myGroup = std::make_shared<const PermutationGroup>(groups::cyclic(Degree{6}));
+    auto myJob = async::cycleIndexPolynomial(myGroup);
+    EXPECT_THAT(myJob.get(), Eq(cycleIndexPolynomial(*myGroup)));
+}
+
+TEST_F(AsyncTest, ErrorsAreRethrownByGet)
+{
+    auto myJob = async::evaluateColours(
+        cycleIndexPolynomial(groups::cyclic(Degree{3})), ColourCount{2},
+        std::vector<Polynomial::VariableName>{Polynomial::VariableName{"r"}}
+    );
+    EXPECT_THROW(static_cast<void>(myJob.get()), std::runtime_error);
+}
+
+TEST_F(AsyncTest, CancelledBeforeStarting)
+{
+    auto myPool = ThreadPool{1, 4};
+    auto myRelease = std::promise<void>{};
+    auto myStarted = std::latch{1};
+    auto myBlocker = async::submit(
+        myPool,
+        [&myStarted, myReleased = myRelease.get_future().share()]
+        {
+            myStarted.count_down();
+            myReleased.wait();
+        }
+    );
+    myStarted.wait();
+
+    auto myJob = async::evaluateColours(
+        cycleIndexPolynomial(groups::cyclic(Degree{4})), ColourCount{2}, std::nullopt, myPool
+    );
+    myJob.cancel();
+    EXPECT_THAT(myJob.isReady(), IsFalse());
+    myRelease.set_value();
+
+    myBlocker.get();
+    EXPECT_THROW(static_cast<void>(myJob.get()), async::Cancelled);
+}
+} // namespace polya::test
@@ -0,0 +1,159 @@
+#include "core/polya-enumeration/polya/ColourCoefficients.hh"
+#include "core/polya-enumeration/group/PermutationGroup.hh"
+#include "core/polya-enumeration/orbit-counting/OrbitCounting.hh"
+#include "core/polya-enumeration/polya/Polya.hh"
+#include "core/polya-enumeration/polynomial/Polynomial.hh"
+#include "core/polya-enumeration/rational/Rational.hh"
+#include "core/util/ExecutionContext.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <stop_token>
+#include <vector>
+
+namespace polya::test
+{
+using namespace ::testing;
+using Exponent = Polynomial::Exponent;
+using Term = Polynomial::Term;
+using ColourCount = orbits::ColourCount;
+using Rank = ColourCoefficients::Rank;
+
+class ColourCoefficientsTest : public ::testing::Test
+{
+};
+
+TEST_F(ColourCoefficientsTest, StreamsTheTermsOfEvaluateColours)
+{
+    for (const auto& myGroup :
+         {groups::cube(), groups::dihedral(Permutation::Degree{7}),
+          groups::symmetric(Permutation::Degree{5}), groups::cyclic(Permutation::Degree{1})})
+    {
+        const auto myCycleIndex = cycleIndexPolynomial(myGroup);
+        for (const auto myColours : {1u, 2u, 4u})
+        {
+            const auto myExpected = evaluateColours(myCycleIndex, ColourCount{myColours});
+            const auto myStream = ColourCoefficients{myCycleIndex, ColourCount{myColours}};
+
+            EXPECT_THAT(myStream.size(), Eq(myExpected.terms().size()));
+            auto myExpectedTerm = myExpected.terms().begin();
+            for (const auto& [myTerm, myCoefficient] : myStream)
+            {
+                ASSERT_THAT(myExpectedTerm, Ne(myExpected.terms().end()));
+                EXPECT_THAT(myTerm, Eq(myExpectedTerm->first));
+                EXPECT_THAT(myCoefficient, Eq(myExpectedTerm->second));
+                ++myExpectedTerm;
+            }
+            EXPECT_THAT(myExpectedTerm, Eq(myExpected.terms().end()));
+        }
+    }
+}
+
+TEST_F(ColourCoefficientsTest, LooksUpSingleCoefficients)
+{
+    const auto myStream = ColourCoefficients{cycleIndexPolynomial(groups::cube()), ColourCount{3}};
+
+    EXPECT_THAT(
+        myStream.coefficient(Term{std::vector{Exponent{3}, Exponent{2}, Exponent{1}}}),
+        Eq(Rational{3})
+    );
+    EXPECT_THAT(
+        myStream.coefficient(Term{std::vector{Exponent{3}, Exponent{2}, Exponent{2}}}),
+        Eq(Rational{0})
+    );
+    EXPECT_THAT(
+        myStream.coefficient(Term{std::vector{Exponent{3}, Exponent{3}}}), Eq(Rational{0})
+    );
+}
+
+TEST_F(ColourCoefficientsTest, RanksAndUnranksTerms)
+{
+    const auto myStream = ColourCoefficients{
+        cycleIndexPolynomial(groups::cyclic(Permutation::Degree{6})), ColourCount{4}};
+
+    EXPECT_THAT(myStream.size(), Eq(84u)); // C(9, 3)
+    for (auto myIterator = myStream.begin(); myIterator != myStream.end(); ++myIterator)
+    {
+        EXPECT_THAT(myStream.term(myIterator.rank()), Eq(myIterator->theTerm));
+        EXPECT_THAT(myStream.rank(myIterator->theTerm).get(), Eq(myIterator.rank().get()));
+    }
+    EXPECT_THAT(
+        myStream.term(Rank{0}),
+        Eq(Term{std::vector{Exponent{0}, Exponent{0}, Exponent{0}, Exponent{6}}})
+    );
+    EXPECT_THAT(
+        myStream.term(Rank{83}),
+        Eq(Term{std::vector{Exponent{6}, Exponent{0}, Exponent{0}, Exponent{0}}})
+    );
+    EXPECT_THROW((void)myStream.term(Rank{84}), std::runtime_error);
+}
+
+TEST_F(ColourCoefficientsTest, RangeStartsAtItsRank)
+{
+    const auto myStream = ColourCoefficients{cycleIndexPolynomial(groups::cube()), ColourCount{3}};
+
+    auto myCount = 0uz;
+    for (const auto& myEntry : myStream.range(Rank{10}, Rank{15}))
+    {
+        EXPECT_THAT(myEntry.theTerm, Eq(myStream.term(Rank{10 + myCount})));
+        EXPECT_THAT(myEntry.theCoefficient, Eq(myStream.coefficient(myEntry.theTerm)));
+        ++myCount;
+    }
+    EXPECT_THAT(myCount, Eq(5uz));
+}
+
+TEST_F(ColourCoefficientsTest, ChunksCoverEveryRankOnce)
+{
+    const auto myCycleIndex = cycleIndexPolynomial(groups::dihedral(Permutation::Degree{9}));
+    const auto myStream = ColourCoefficients{myCycleIndex, ColourCount{4}};
+    const auto myExpected = evaluateColours(myCycleIndex, ColourCount{4});
+
+    auto myMutex = std::mutex{};
+    auto mySeen = std::vector<int>(myStream.size(), 0);
+    auto mySum = Rational{0};
+    myStream.forEachChunk(
+        7,
+        [&](const ColourCoefficients::Range& aRange)
+        {
+            auto myChunkSum = Rational{0};
+            auto myRanks = std::vector<std::uint64_t>{};
+            for (auto myIterator = aRange.begin(); myIterator != aRange.end(); ++myIterator)
+            {
+                EXPECT_THAT(
+                    myIterator->theCoefficient, Eq(myExpected.coefficient(myIterator->theTerm))
+                );
+                myChunkSum += myIterator->theCoefficient;
+                myRanks.push_back(myIterator.rank().get());
+            }
+            const auto myLock = std::scoped_lock{myMutex};
+            mySum += myChunkSum;
+            for (const auto myRank : myRanks)
+            {
+                ++mySeen[myRank];
+            }
+        }
+    );
+
+    EXPECT_THAT(mySeen, Each(Eq(1)));
+    const auto myOrbits =
+        orbits::countOrbits(groups::dihedral(Permutation::Degree{9}), ColourCount{4});
+    EXPECT_THAT(mySum, Eq(Rational{static_cast<std::int64_t>(myOrbits.get())}));
+}
+
+TEST_F(ColourCoefficientsTest, ChunksStopWhenCancelled)
+{
+    const auto myStream = ColourCoefficients{cycleIndexPolynomial(groups::cube()), ColourCount{3}};
+    auto mySource = std::stop_source{};
+    mySource.request_stop();
+
+    EXPECT_THROW(
+        myStream.forEachChunk(
+            1, [](const ColourCoefficients::Range&) {},
+            ExecutionContext{mySource.get_token()}
+        ),
+        Interrupted
+    );
+}
+} // namespace polya::test
@@ -0,0 +1,83 @@
+#include "core/polya-enumeration/polya/CostEstimate.hh"
+#include "core/polya-enumeration/group/GroupCatalog.hh"
+#include "core/polya-enumeration/group/PermutationGroup.hh"
+#include "core/polya-enumeration/polya/Polya.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <limits>
+
+namespace polya::test
+{
+using namespace ::testing;
+using ColourCount = orbits::ColourCount;
+using Degree = Permutation::Degree;
+using Family = GroupCatalog::Family;
+
+class CostEstimateTest : public ::testing::Test
+{
+};
+
+TEST_F(CostEstimateTest, OutputTermsAreCompositions)
+{
+    for (const auto& myGroup :
+         {groups::cyclic(Degree{8}), groups::dihedral(Degree{6}), groups::symmetric(Degree{5}),
+          groups::cube()})
+    {
+        for (const auto myColours : {1u, 2u, 3u, 5u})
+        {
+            const auto myEstimate = estimateCost(myGroup, ColourCount{myColours});
+            const auto myResult =
+                evaluateColours(cycleIndexPolynomial(myGroup), ColourCount{myColours});
+            EXPECT_THAT(myEstimate.theOutputTerms, Eq(myResult.terms().size()));
+            EXPECT_THAT(
+                myEstimate.theSymmetricTerms,
+                Eq(SymmetricPolynomial::fromPolynomial(myResult).terms().size())
+            );
+        }
+    }
+}
+
+TEST_F(CostEstimateTest, CycleIndexTermsAreBounded)
+{
+    for (const auto& myGroup :
+         {groups::cyclic(Degree{12}), groups::dihedral(Degree{9}), groups::symmetric(Degree{6}),
+          groups::tetrahedron()})
+    {
+        const auto myEstimate = estimateCost(myGroup, ColourCount{2});
+        EXPECT_THAT(myEstimate.theGroupOrder, Eq(myGroup.order().get()));
+        EXPECT_THAT(
+            myEstimate.theCycleIndexTerms, Ge(cycleIndexPolynomial(myGroup).terms().size())
+        );
+    }
+    // Every cycle type of S_n occurs, and p(6) = 11
+    EXPECT_THAT(
+        estimateCost(groups::symmetric(Degree{6}), ColourCount{2}).theCycleIndexTerms, Eq(11u)
+    );
+}
+
+TEST_F(CostEstimateTest, CostGrowsWithColours)
+{
+    const auto myFew = estimateCost(Degree{12}, 12, ColourCount{2});
+    const auto myMany = estimateCost(Degree{12}, 12, ColourCount{6});
+    EXPECT_THAT(myMany.theEvaluationBytes, Gt(myFew.theEvaluationBytes));
+    EXPECT_THAT(myMany.theEvaluationTime, Gt(myFew.theEvaluationTime));
+    EXPECT_THAT(myMany.theCycleIndexTime, Eq(myFew.theCycleIndexTime));
+}
+
+TEST_F(CostEstimateTest, Saturates)
+{
+    const auto myEstimate = estimateCost(
+        Degree{500}, GroupCatalog::order(Family::Symmetric, Degree{500}), ColourCount{40}
+    );
+    constexpr auto myMaximum = std::numeric_limits<std::uint64_t>::max();
+    EXPECT_THAT(myEstimate.theGroupOrder, Eq(myMaximum));
+    EXPECT_THAT(myEstimate.theOutputTerms, Eq(myMaximum));
+    EXPECT_THAT(myEstimate.peakBytes(), Eq(myMaximum));
+    EXPECT_THAT(
+        myEstimate.theEvaluationTime.count(),
+        Eq(std::numeric_limits<std::chrono::nanoseconds::rep>::max())
+    );
+}
+} // namespace polya::test
@@ -1,5 +1,7 @@
 #include "core/polya-enumeration/polya/Polya.hh"
+#include "core/polya-enumeration/cycle-index/CycleIndexAlgebra.hh"
 #include "core/polya-enumeration/group/PermutationGroup.hh"
+#include "core/polya-enumeration/modular/Modular.hh"
 #include "core/polya-enumeration/orbit-counting/OrbitCounting.hh"
 #include "core/polya-enumeration/polynomial/Polynomial.hh"
 #include "core/polya-enumeration/rational/Rational.hh"
@@ -7,6 +9,11 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
 namespace polya::test
 {
 using namespace ::testing;
@@ -26,7 +33,7 @@ TEST_F(PolyaTest, CycleIndexTrivialGroup)
     const auto myZ = cycleIndexPolynomial(myGroup);
 
     const auto myTerm = Term{std::vector{Exponent{3}, Exponent{0}, Exponent{0}}};
-    EXPECT_THAT(myZ.get().coefficient(myTerm), Eq(Rational{1}));
+    EXPECT_THAT(myZ.toPolynomial().coefficient(myTerm), Eq(Rational{1}));
 }
 
 TEST_F(PolyaTest, CycleIndexCyclic4)
@@ -35,29 +42,67 @@ TEST_F(PolyaTest, CycleIndexCyclic4)
     const auto myZ = cycleIndexPolynomial(myGroup);
 
     EXPECT_THAT(
-        myZ.get().coefficient(Term{std::vector{Exponent{4}, Exponent{0}, Exponent{0}, Exponent{0}}}
+        myZ.toPolynomial().coefficient(
+            Term{std::vector{Exponent{4}, Exponent{0}, Exponent{0}, Exponent{0}}}
         ),
         Eq(Rational{Rational::Numerator{1}, Rational::Denominator{4}})
     );
     EXPECT_THAT(
-        myZ.get().coefficient(Term{std::vector{Exponent{0}, Exponent{2}, Exponent{0}, Exponent{0}}}
+        myZ.toPolynomial().coefficient(
+            Term{std::vector{Exponent{0}, Exponent{2}, Exponent{0}, Exponent{0}}}
         ),
         Eq(Rational{Rational::Numerator{1}, Rational::Denominator{4}})
     );
     EXPECT_THAT(
-        myZ.get().coefficient(Term{std::vector{Exponent{0}, Exponent{0}, Exponent{0}, Exponent{1}}}
+        myZ.toPolynomial().coefficient(
+            Term{std::vector{Exponent{0}, Exponent{0}, Exponent{0}, Exponent{1}}}
         ),
         Eq(Rational{Rational::Numerator{1}, Rational::Denominator{2}})
     );
 }
 
+TEST_F(PolyaTest, CycleIndexCyclicTermsAreSparse)
+{
+    const auto myGroup = groups::cyclic(Permutation::Degree{60});
+    const auto myZ = cycleIndexPolynomial(myGroup);
+
+    // One term per divisor d of 60, each a single part (d, 60 / d) with coefficient phi(d) / 60
+    EXPECT_THAT(myZ.terms().size(), Eq(12uz));
+    for (const auto& [myCycleType, myCoefficient] : myZ.terms())
+    {
+        EXPECT_THAT(myCycleType.parts().size(), Eq(1uz));
+    }
+    EXPECT_THAT(
+        myZ.coefficient(CycleType{std::vector{
+            CycleType::Part{CycleType::Length{60}, CycleType::Multiplicity{1}}}}),
+        Eq(Rational{Rational::Numerator{16}, Rational::Denominator{60}})
+    );
+}
+
+TEST_F(PolyaTest, CycleIndexLargeGroupCountsEveryElement)
+{
+    // Large enough to be split across threads
+    const auto myGroup = groups::symmetric(Permutation::Degree{8});
+    const auto myZ = cycleIndexPolynomial(myGroup);
+
+    EXPECT_THAT(myZ.terms().size(), Eq(22uz)); // Partitions of 8
+    EXPECT_THAT(
+        myZ.coefficient(CycleType{std::vector{
+            CycleType::Part{CycleType::Length{1}, CycleType::Multiplicity{8}}}}),
+        Eq(Rational{Rational::Numerator{1}, Rational::Denominator{40320}})
+    );
+    EXPECT_THAT(
+        evaluateUniform(myZ, ColourCount{3}), Eq(orbits::countOrbits(myGroup, ColourCount{3}))
+    );
+}
+
 TEST_F(PolyaTest, CycleIndexCustomVariables)
 {
     const auto myGroup = groups::cyclic(Permutation::Degree{2});
     const auto myVariables = std::vector{VariableName{"a"}, VariableName{"b"}};
     const auto myZ = cycleIndexPolynomial(myGroup, myVariables);
 
-    EXPECT_THAT(myZ.get().toString(), Eq("+(1/2)b^1 +(1/2)a^2"));
+    EXPECT_THAT(myZ.toPolynomial().toString(), Eq("+(1/2)b^1 +(1/2)a^2"));
 }
 
 TEST_F(PolyaTest, EvaluateUniformTrivialGroup)
@@ -233,4 +278,325 @@ TEST_F(PolyaTest, EvaluateColoursTetrahedronWith3Colours)
     );
 }
 
+TEST_F(PolyaTest, EvaluateColoursWithCaps)
+{
+    const auto myZ = cycleIndexPolynomial(groups::cube());
+    auto myExpected = evaluateColours(myZ, ColourCount{3});
+
+    // At most two of the first colour and three of the second
+    const auto myCaps = Polynomial::Caps{{Exponent{2}, Exponent{3}, std::nullopt}, std::nullopt};
+    const auto myResult = evaluateColours(
+        myZ, ColourCount{3}, std::nullopt, ExecutionContext::unlimited(), myCaps
+    );
+    EXPECT_THAT(myResult, Eq(myExpected.truncate(myCaps)));
+    EXPECT_THAT(myResult.terms().size(), Eq(12uz));
+    EXPECT_THAT(
+        myResult.coefficient(Term{std::vector{Exponent{2}, Exponent{3}, Exponent{1}}}),
+        Eq(Rational{3})
+    );
+}
+
+TEST_F(PolyaTest, EvaluateSymmetricColoursStoresSortedTerms)
+{
+    for (const auto& myGroup :
+         {groups::cube(), groups::dihedral(Permutation::Degree{8}),
+          groups::trivial(Permutation::Degree{3})})
+    {
+        const auto myZ = cycleIndexPolynomial(myGroup);
+        for (const auto myColours : {1u, 3u, 5u})
+        {
+            const auto myExpected = evaluateColours(myZ, ColourCount{myColours});
+            const auto myResult = evaluateSymmetricColours(myZ, ColourCount{myColours});
+            EXPECT_THAT(myResult, Eq(SymmetricPolynomial::fromPolynomial(myExpected)));
+            EXPECT_THAT(myResult.termCount(), Eq(myExpected.terms().size()));
+        }
+    }
+
+    // Partitions of 6 into at most 4 parts
+    const auto myCube =
+        evaluateSymmetricColours(cycleIndexPolynomial(groups::cube()), ColourCount{4});
+    EXPECT_THAT(myCube.terms().size(), Eq(9uz));
+    EXPECT_THAT(
+        myCube.coefficient(Term{std::vector{Exponent{1}, Exponent{2}, Exponent{0}, Exponent{3}}}),
+        Eq(Rational{3})
+    );
+}
+
+TEST_F(PolyaTest, EvaluateSeriesCountsOrbitsByWeight)
+{
+    const auto myZ = cycleIndexPolynomial(groups::cube());
+
+    // One figure of weight 0 and one of weight 1: cube colourings by number of black faces
+    const auto myBlackOrWhite =
+        PowerSeries{std::vector{Rational{1}, Rational{1}}, PowerSeries::Order{2}};
+    const auto myByBlackFaces = evaluateSeries(myZ, myBlackOrWhite, PowerSeries::Order{8});
+    EXPECT_THAT(
+        myByBlackFaces.coefficients(),
+        Eq(std::vector{
+            Rational{1}, Rational{1}, Rational{2}, Rational{2}, Rational{2}, Rational{1},
+            Rational{1}, Rational{0}})
+    );
+
+    // Three figures of weight 0 count all colourings
+    const auto myThreeColours = PowerSeries{std::vector{Rational{3}}, PowerSeries::Order{1}};
+    EXPECT_THAT(
+        evaluateSeries(myZ, myThreeColours, PowerSeries::Order{1}).coefficient(0),
+        Eq(Rational{57})
+    );
+
+    // Weights 0, 1 and 2 for three colours sum the colour polynomial by c_2 + 2 c_3
+    const auto myWeighted =
+        PowerSeries{std::vector{Rational{1}, Rational{1}, Rational{1}}, PowerSeries::Order{13}};
+    const auto mySeries = evaluateSeries(myZ, myWeighted, PowerSeries::Order{13});
+    const auto myColours = evaluateColours(myZ, ColourCount{3});
+    auto myExpected = std::vector<Rational>(13, Rational{0});
+    for (const auto& [myTerm, myCoefficient] : myColours.terms())
+    {
+        myExpected[myTerm.get()[1].get() + 2 * myTerm.get()[2].get()] += myCoefficient;
+    }
+    EXPECT_THAT(mySeries.coefficients(), Eq(myExpected));
+}
+
+TEST_F(PolyaTest, EulerTransformSumsSymmetricCycleIndices)
+{
+    // Multisets of figures of weights 1, 1 and 2 up to t^6, from Z(S_0) + ... + Z(S_6)
+    const auto myFigures =
+        PowerSeries{std::vector{Rational{0}, Rational{2}, Rational{1}}, PowerSeries::Order{7}};
+    auto myExpected = PowerSeries::one(PowerSeries::Order{7});
+    for (auto myDegree = 1uz; myDegree < 7; ++myDegree)
+    {
+        myExpected += evaluateSeries(
+            cycleIndexPolynomial(groups::symmetric(Permutation::Degree{myDegree})), myFigures,
+            PowerSeries::Order{7}
+        );
+    }
+    EXPECT_THAT(eulerTransform(myFigures), Eq(myExpected));
+}
+
+TEST_F(PolyaTest, SymmetricCycleIndexMatchesGroup)
+{
+    for (auto myDegree = 1uz; myDegree <= 6; ++myDegree)
+    {
+        EXPECT_THAT(
+            symmetricCycleIndex(Permutation::Degree{myDegree}),
+            Eq(cycleIndexPolynomial(groups::symmetric(Permutation::Degree{myDegree})))
+        );
+    }
+}
+
+TEST_F(PolyaTest, InducedActionsCountGraphs)
+{
+    // Graphs on n vertices are the 2-colourings of the edges under S_n
+    const auto myGraphs = std::vector<std::uint64_t>{1, 2, 4, 11, 34, 156, 1044};
+    for (auto myDegree = 1uz; myDegree <= myGraphs.size(); ++myDegree)
+    {
+        const auto myEdges = inducedCycleIndex(
+            symmetricCycleIndex(Permutation::Degree{myDegree}), InducedAction::Edges
+        );
+        EXPECT_THAT(
+            evaluateUniform(myEdges, ColourCount{2}), Eq(OrbitCount{myGraphs[myDegree - 1]})
+        );
+    }
+
+    // By number of edges on four vertices
+    const auto myEdges =
+        inducedCycleIndex(symmetricCycleIndex(Permutation::Degree{4}), InducedAction::Edges);
+    EXPECT_THAT(
+        evaluateSeries(
+            myEdges, PowerSeries{std::vector{Rational{1}, Rational{1}}, PowerSeries::Order{2}},
+            PowerSeries::Order{7}
+        )
+            .coefficients(),
+        Eq(std::vector{
+            Rational{1}, Rational{1}, Rational{2}, Rational{3}, Rational{2}, Rational{1},
+            Rational{1}})
+    );
+
+    // Loopless digraphs on three vertices and binary relations on two points
+    EXPECT_THAT(
+        evaluateUniform(
+            inducedCycleIndex(
+                symmetricCycleIndex(Permutation::Degree{3}), InducedAction::DirectedEdges
+            ),
+            ColourCount{2}
+        ),
+        Eq(OrbitCount{16})
+    );
+    EXPECT_THAT(
+        evaluateUniform(
+            inducedCycleIndex(
+                symmetricCycleIndex(Permutation::Degree{2}), InducedAction::OrderedPairs
+            ),
+            ColourCount{2}
+        ),
+        Eq(OrbitCount{10})
+    );
+
+    // Three faces of a cube either meet at a corner or wrap around it. Orbits of 3-subsets are
+    // counted by the average number of fixed points
+    const auto mySubsets = subsetCycleIndex(cycleIndexPolynomial(groups::cube()), 3);
+    auto myOrbits = Rational{0};
+    for (const auto& [myCycleType, myCoefficient] : mySubsets.terms())
+    {
+        myOrbits += myCoefficient
+                    * Rational{static_cast<std::int64_t>(
+                        myCycleType.multiplicity(CycleType::Length{1}).get()
+                    )};
+    }
+    EXPECT_THAT(myOrbits, Eq(Rational{2}));
+}
+
+TEST_F(PolyaTest, ModularCycleIndicesCountGraphsPast20Vertices)
+{
+    // Graphs on 30 vertices number about 2^328, checked against exact sums over the partitions
+    const auto myModulus = Modular::Modulus{998244353};
+    const auto myEdges = inducedCycleIndex(
+        symmetricCycleIndex(Permutation::Degree{30}, myModulus), InducedAction::Edges
+    );
+    EXPECT_THAT(evaluateUniform(myEdges, ColourCount{2}), Eq(Modular{512702611, myModulus}));
+
+    // Graphs on at least 2k vertices with k edges do not depend on the number of vertices
+    const auto myZero = Modular{0, myModulus};
+    const auto myOne = Modular{1, myModulus};
+    const auto myByEdges = evaluateSeries(
+        myEdges, ModularPowerSeries{std::vector{myOne, myOne}, PowerSeries::Order{2}, myZero},
+        PowerSeries::Order{16}
+    );
+    const auto myExpected = std::vector<std::int64_t>{
+        1, 1, 2, 5, 11, 26, 68, 177, 497, 1476, 4613, 15216, 52944, 193367, 740226, 2960520};
+    for (auto myIndex = 0uz; myIndex < myExpected.size(); ++myIndex)
+    {
+        EXPECT_THAT(myByEdges.coefficient(myIndex), Eq(Modular{myExpected[myIndex], myModulus}));
+    }
+}
+
+TEST_F(PolyaTest, ProductsMatchGeneratedGroups)
+{
+    const auto myCyclic3 = cycleIndexPolynomial(groups::cyclic(Permutation::Degree{3}));
+    const auto myCyclic2 = cycleIndexPolynomial(groups::cyclic(Permutation::Degree{2}));
+    const auto generated = [](std::vector<std::vector<std::uint32_t>> aBijections)
+    {
+        auto myGenerators = std::vector<Permutation>{};
+        for (const auto& myBijection : aBijections)
+        {
+            auto myElements = std::vector<Permutation::Element>{};
+            for (const auto myElement : myBijection)
+            {
+                myElements.emplace_back(myElement);
+            }
+            myGenerators.emplace_back(std::move(myElements));
+        }
+        const auto myDegree = Permutation::Degree{aBijections.front().size()};
+        return cycleIndexPolynomial(PermutationGroup{
+            "product", myDegree, PermutationGroup::Generators{std::move(myGenerators)}});
+    };
+
+    EXPECT_THAT(
+        directProduct(myCyclic3, myCyclic2),
+        Eq(generated({{1, 2, 0, 3, 4}, {0, 1, 2, 4, 3}}))
+    );
+    // (i, j) is the point 2 i + j
+    EXPECT_THAT(
+        cartesianProduct(myCyclic3, myCyclic2),
+        Eq(generated({{2, 3, 4, 5, 0, 1}, {1, 0, 3, 2, 5, 4}}))
+    );
+    // Rotating the three pairs, and swapping within the first one
+    EXPECT_THAT(
+        wreathProduct(myCyclic3, myCyclic2),
+        Eq(generated({{2, 3, 4, 5, 0, 1}, {1, 0, 2, 3, 4, 5}}))
+    );
+
+    // S_3 wr S_2: swapping two triples, and permuting the first one
+    EXPECT_THAT(
+        compose(
+            cycleIndexPolynomial(groups::symmetric(Permutation::Degree{2})),
+            cycleIndexPolynomial(groups::symmetric(Permutation::Degree{3}))
+        ),
+        Eq(generated({{3, 4, 5, 0, 1, 2}, {1, 2, 0, 3, 4, 5}, {1, 0, 2, 3, 4, 5}}))
+    );
+}
+
+TEST_F(PolyaTest, TryCycleIndexPolynomial)
+{
+    const auto myGroup = groups::cyclic(Permutation::Degree{2});
+    const auto myZ = tryCycleIndexPolynomial(myGroup);
+    ASSERT_THAT(myZ.has_value(), IsTrue());
+    EXPECT_THAT(*myZ, Eq(cycleIndexPolynomial(myGroup)));
+
+    const auto myInvalidZ = tryCycleIndexPolynomial(myGroup, std::vector{VariableName{"a"}});
+    ASSERT_THAT(myInvalidZ.has_value(), IsFalse());
+    EXPECT_THAT(myInvalidZ.error(), Eq(Error{Error::Code::VariableCountMismatch, 1, 2}));
+}
+
+TEST_F(PolyaTest, TryEvaluateColours)
+{
+    const auto myZ = cycleIndexPolynomial(groups::cyclic(Permutation::Degree{4}));
+    const auto myResult = tryEvaluateColours(myZ, ColourCount{2});
+    ASSERT_THAT(myResult.has_value(), IsTrue());
+    EXPECT_THAT(*myResult, Eq(evaluateColours(myZ, ColourCount{2})));
+
+    const auto myInvalidResult =
+        tryEvaluateColours(myZ, ColourCount{2}, std::vector{VariableName{"r"}});
+    ASSERT_THAT(myInvalidResult.has_value(), IsFalse());
+    EXPECT_THAT(
+        myInvalidResult.error().message(),
+        Eq("Expected the number of colour names (1) to match the colour count (2)")
+    );
+}
+
+TEST_F(PolyaTest, CycleIndexStopsWhenCancelled)
+{
+    auto mySource = std::stop_source{};
+    mySource.request_stop();
+    EXPECT_THROW(
+        static_cast<void>(cycleIndexPolynomial(
+            groups::symmetric(Permutation::Degree{4}), std::nullopt,
+            ExecutionContext{mySource.get_token()}
+        )),
+        Interrupted
+    );
+}
+
+TEST_F(PolyaTest, EvaluateColoursStopsAtDeadline)
+{
+    const auto myZ = cycleIndexPolynomial(groups::cube());
+    const auto myContext = ExecutionContext{
+        std::stop_token{}, ExecutionContext::Clock::now() - std::chrono::seconds{1}};
+    try
+    {
+        static_cast<void>(evaluateColours(myZ, ColourCount{3}, std::nullopt, myContext));
+        FAIL() << "Expected Interrupted";
+    }
+    catch (const Interrupted& anError)
+    {
+        EXPECT_THAT(anError.reason(), Eq(Interrupted::Reason::DeadlineExceeded));
+    }
+}
+
+TEST_F(PolyaTest, ReportsCycleIndexProgress)
+{
+    const auto myGroup = groups::symmetric(Permutation::Degree{7});
+    auto myMutex = std::mutex{};
+    auto myProgress = std::vector<ExecutionContext::Progress>{};
+    const auto myContext = ExecutionContext{
+        std::stop_token{}, std::nullopt,
+        [&](const ExecutionContext::Progress& aProgress)
+        {
+            const auto myLock = std::scoped_lock{myMutex};
+            myProgress.push_back(aProgress);
+        }};
+    EXPECT_THAT(
+        cycleIndexPolynomial(myGroup, std::nullopt, myContext), Eq(cycleIndexPolynomial(myGroup))
+    );
+
+    // 5040 elements are histogrammed in two chunks
+    ASSERT_THAT(myProgress.size(), Eq(2u));
+    for (const auto& myReport : myProgress)
+    {
+        EXPECT_THAT(myReport.thePhase, Eq(stats::Phase::CycleIndex));
+        EXPECT_THAT(myReport.theTotal, Eq(5040u));
+        EXPECT_THAT(myReport.theProcessed, AnyOf(Eq(0u), Eq(4096u), Eq(944u)));
+    }
+}
+
 } // namespace polya::test
@@ -1,6 +1,7 @@
 #include "core/polya-enumeration/polynomial/Polynomial.hh"
 
 #include "core/util/Exception.hh"
+#include "core/util/Stats.hh"
 
 #include <range/v3/all.hpp>
 #include <string>
@@ -13,6 +14,17 @@ using VariableName = Polynomial::VariableName;
 using Exponent = Polynomial::Exponent;
 using Term = Polynomial::Term;
 
+namespace
+{
+auto totalDegree(const Term& aTerm) -> std::uint64_t
+{
+    return ranges::accumulate(
+        aTerm.get(), std::uint64_t{0},
+        [](std::uint64_t aSum, const Exponent& anExponent) { return aSum + anExponent.get(); }
+    );
+}
+} // namespace
+
 auto Polynomial::TermComparator::operator()(const Term& aFirstTerm, const Term& aSecondTerm)
     const noexcept -> bool
 {
@@ -51,11 +63,21 @@ auto Polynomial::set(const Term& aTerm, const Rational& aCoefficient) -> void
         "Expected term with {} exponents, but received {}", theVariableNames.size(),
         aTerm.get().size()
     );
+    setUnchecked(aTerm, aCoefficient);
+}
+
+auto Polynomial::setUnchecked(const Term& aTerm, const Rational& aCoefficient) -> void
+{
     if (aCoefficient == Rational{0})
     {
         return;
     }
-    theCoefficientMap.insert_or_assign(aTerm, aCoefficient);
+    const auto [myTerm, myInserted] = theCoefficientMap.insert_or_assign(aTerm, aCoefficient);
+    stats::count(stats::Counter::MapInsertions);
+    if (myInserted)
+    {
+        stats::count(stats::Counter::PolynomialTermsCreated);
+    }
 }
 
 auto Polynomial::isZero() const -> bool
@@ -81,7 +103,7 @@ auto Polynomial::operator+=(const Polynomial& aPolynomial) -> Polynomial&
 
     for (const auto& [myTerm, myCoefficient] : aPolynomial.terms())
     {
-        set(myTerm, coefficient(myTerm) + myCoefficient);
+        setUnchecked(myTerm, coefficient(myTerm) + myCoefficient);
     }
     return *this;
 }
@@ -95,42 +117,107 @@ auto Polynomial::operator-=(const Polynomial& aPolynomial) -> Polynomial&
 
     for (const auto& [myTerm, myCoefficient] : aPolynomial.terms())
     {
-        set(myTerm, coefficient(myTerm) - myCoefficient);
+        setUnchecked(myTerm, coefficient(myTerm) - myCoefficient);
     }
     return *this;
 }
 
 auto Polynomial::operator*=(const Polynomial& aPolynomial) -> Polynomial&
+{
+    return multiply(aPolynomial, ExecutionContext::unlimited());
+}
+
+auto Polynomial::multiply(const Polynomial& aPolynomial, const ExecutionContext& aContext)
+    -> Polynomial&
+{
+    return multiply(aPolynomial, Caps{}, aContext);
+}
+
+auto Polynomial::multiply(
+    const Polynomial& aPolynomial, const Caps& aCaps, const ExecutionContext& aContext
+) -> Polynomial&
 {
     ensure(
         variables() == aPolynomial.variables(),
         "Cannot multiply polynomials with different variables"
     );
+    ensure(
+        aCaps.thePerVariable.empty() or aCaps.thePerVariable.size() == theVariableNames.size(),
+        "Expected {} exponent caps, but received {}", theVariableNames.size(),
+        aCaps.thePerVariable.size()
+    );
+    const auto myTimer = stats::ScopedTimer{stats::Phase::PolynomialMultiplication};
 
     auto myResult = Polynomial{theVariableNames};
-    for (const auto& [myFirst, mySecond] :
-         views::cartesian_product(theCoefficientMap, aPolynomial.terms()))
+    auto myRow = 0uz;
+    auto myExponents = std::vector<Exponent>(theVariableNames.size(), Exponent{0});
+    for (const auto& [myTerm, myCoefficient] : theCoefficientMap)
     {
-        const auto& [myTerm, myCoefficient] = myFirst;
-        const auto& [myOtherTerm, myOtherCoefficient] = mySecond;
-        const auto myNewExponents = views::zip(myTerm.get(), myOtherTerm.get())
-                                    | views::transform(
-                                        [](const auto& aPair)
-                                        {
-                                            const auto& [myFirst, mySecond] = aPair;
-                                            return Exponent{myFirst.get() + mySecond.get()};
-                                        }
-                                    )
-                                    | ranges::to<std::vector>();
-        const auto myNewTerm = Term{myNewExponents};
-        myResult.set(
-            myNewTerm, myResult.coefficient(myNewTerm) + myCoefficient * myOtherCoefficient
+        aContext.checkpoint(
+            stats::Phase::PolynomialMultiplication, myRow++, theCoefficientMap.size()
         );
+        const auto myDegree = totalDegree(myTerm);
+        if (aCaps.theTotal and myDegree > aCaps.theTotal->get())
+        {
+            break; // Terms are ordered by total degree, so no later row has products in range
+        }
+        for (const auto& [myOtherTerm, myOtherCoefficient] : aPolynomial.terms())
+        {
+            if (aCaps.theTotal and myDegree + totalDegree(myOtherTerm) > aCaps.theTotal->get())
+            {
+                break;
+            }
+            auto myAdmitted = true;
+            for (auto myIndex = 0uz; myIndex < myExponents.size(); ++myIndex)
+            {
+                myExponents[myIndex] =
+                    Exponent{myTerm.get()[myIndex].get() + myOtherTerm.get()[myIndex].get()};
+                if (not aCaps.thePerVariable.empty() and aCaps.thePerVariable[myIndex]
+                    and myExponents[myIndex].get() > aCaps.thePerVariable[myIndex]->get())
+                {
+                    myAdmitted = false;
+                    break;
+                }
+            }
+            if (not myAdmitted)
+            {
+                continue;
+            }
+            const auto myNewTerm = Term{myExponents};
+            myResult.setUnchecked(
+                myNewTerm, myResult.coefficient(myNewTerm) + myCoefficient * myOtherCoefficient
+            );
+        }
     }
     *this = std::move(myResult);
     return *this;
 }
 
+auto Polynomial::truncate(const Caps& aCaps) -> Polynomial&
+{
+    std::erase_if(
+        theCoefficientMap, [&](const auto& aPair) { return not aCaps.admits(aPair.first); }
+    );
+    return *this;
+}
+
+auto Polynomial::Caps::admits(const Term& aTerm) const -> bool
+{
+    if (theTotal and totalDegree(aTerm) > theTotal->get())
+    {
+        return false;
+    }
+    return thePerVariable.empty()
+           or ranges::all_of(
+               views::zip(aTerm.get(), thePerVariable),
+               [](const auto& aPair)
+               {
+                   const auto& [myExponent, myCap] = aPair;
+                   return not myCap or myExponent.get() <= myCap->get();
+               }
+           );
+}
+
 auto Polynomial::operator+(const Polynomial& aPolynomial) const -> Polynomial
 {
     auto myResult = *this;
@@ -208,7 +295,7 @@ auto operator*(const Rational& aRational, const Polynomial& aPolynomial) -> Poly
     auto myPolynomial = aPolynomial;
     for (const auto& [myTerm, myCoefficient] : myPolynomial.terms())
     {
-        myPolynomial.set(myTerm, aRational * myCoefficient);
+        myPolynomial.setUnchecked(myTerm, aRational * myCoefficient);
     }
     return myPolynomial;
 }
@@ -1,10 +1,12 @@
 #pragma once
 
 #include "core/polya-enumeration/rational/Rational.hh"
+#include "core/util/ExecutionContext.hh"
 #include "core/util/Type.hh"
 
 #include <cstdint>
 #include <map>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -20,6 +22,16 @@ public:
     using Exponent = Type<std::uint32_t, struct ExponentTag>;
     using Term = Type<std::vector<Exponent>, struct TermTag>;
 
+    // Degree bounds for truncated products: terms with an exponent above its variable's cap or a
+    // total degree above theTotal are dropped as they are formed
+    struct Caps
+    {
+        std::vector<std::optional<Exponent>> thePerVariable; // Empty, or one per variable
+        std::optional<Exponent> theTotal;
+
+        [[nodiscard]] auto admits(const Term& aTerm) const -> bool;
+    };
+
 private:
     struct TermComparator
     {
@@ -31,6 +43,7 @@ public:
 
     [[nodiscard]] auto coefficient(const Term& aTerm) const -> Rational;
     auto set(const Term& aTerm, const Rational& aCoefficient) -> void;
+    auto setUnchecked(const Term& aTerm, const Rational& aCoefficient) -> void; // For hot paths
 
     [[nodiscard]] auto isZero() const -> bool;
     [[nodiscard]] auto variables() const -> const std::vector<VariableName>&;
@@ -39,6 +52,14 @@ public:
     auto operator+=(const Polynomial& aPolynomial) -> Polynomial&;
     auto operator-=(const Polynomial& aPolynomial) -> Polynomial&;
     auto operator*=(const Polynomial& aPolynomial) -> Polynomial&;
+    auto multiply(const Polynomial& aPolynomial, const ExecutionContext& aContext)
+        -> Polynomial&; // *=, with a checkpoint per term of this polynomial
+    auto multiply(
+        const Polynomial& aPolynomial,
+        const Caps& aCaps,
+        const ExecutionContext& aContext = ExecutionContext::unlimited()
+    ) -> Polynomial&; // Skips the products that aCaps does not admit
+    auto truncate(const Caps& aCaps) -> Polynomial&;
     [[nodiscard]] auto operator+(const Polynomial& aPolynomial) const -> Polynomial;
     [[nodiscard]] auto operator-(const Polynomial& aPolynomial) const -> Polynomial;
     [[nodiscard]] auto operator*(const Polynomial& aPolynomial) const -> Polynomial;
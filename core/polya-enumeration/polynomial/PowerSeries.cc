@@ -0,0 +1,460 @@
+#include "core/polya-enumeration/polynomial/PowerSeries.hh"
+
+#include "core/util/Exception.hh"
+#include "core/util/Stats.hh"
+
+#include <range/v3/all.hpp>
+#include <utility>
+
+namespace polya
+{
+namespace views = ranges::views;
+
+namespace
+{
+// anInteger in the coefficient ring of aZero
+auto integer(const Rational&, std::size_t anInteger) -> Rational
+{
+    return Rational{static_cast<std::int64_t>(anInteger)};
+}
+
+auto integer(const Modular& aZero, std::size_t anInteger) -> Modular
+{
+    return Modular{static_cast<std::int64_t>(anInteger), aZero.modulus()};
+}
+} // namespace
+
+template <typename Coefficient>
+BasicPowerSeries<Coefficient>::BasicPowerSeries(Order anOrder, Coefficient aZero)
+    : theZero{std::move(aZero)}, theCoefficients(anOrder.get(), theZero)
+{
+}
+
+template <typename Coefficient>
+BasicPowerSeries<Coefficient>::BasicPowerSeries(
+    std::vector<Coefficient> aCoefficients, Order anOrder, Coefficient aZero
+)
+    : theZero{std::move(aZero)}, theCoefficients{std::move(aCoefficients)}
+{
+    theCoefficients.resize(anOrder.get(), theZero);
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::one(Order anOrder, Coefficient aZero) -> BasicPowerSeries
+{
+    auto mySeries = BasicPowerSeries{anOrder, aZero};
+    mySeries.set(0, integer(aZero, 1));
+    return mySeries;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::order() const -> Order
+{
+    return Order{theCoefficients.size()};
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::zero() const -> const Coefficient&
+{
+    return theZero;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::coefficient(std::size_t aDegree) const -> Coefficient
+{
+    return aDegree < theCoefficients.size() ? theCoefficients[aDegree] : theZero;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::set(std::size_t aDegree, const Coefficient& aCoefficient)
+    -> void
+{
+    if (aDegree < theCoefficients.size())
+    {
+        theCoefficients[aDegree] = aCoefficient;
+    }
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::coefficients() const -> const std::vector<Coefficient>&
+{
+    return theCoefficients;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::isZero() const -> bool
+{
+    return ranges::all_of(
+        theCoefficients, [this](const auto& aCoefficient) { return aCoefficient == theZero; }
+    );
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::operator+=(const BasicPowerSeries& aSeries)
+    -> BasicPowerSeries&
+{
+    checkOrder(aSeries);
+    for (auto myDegree = 0uz; myDegree < theCoefficients.size(); ++myDegree)
+    {
+        if (aSeries.theCoefficients[myDegree] != theZero)
+        {
+            theCoefficients[myDegree] += aSeries.theCoefficients[myDegree];
+        }
+    }
+    return *this;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::operator-=(const BasicPowerSeries& aSeries)
+    -> BasicPowerSeries&
+{
+    checkOrder(aSeries);
+    for (auto myDegree = 0uz; myDegree < theCoefficients.size(); ++myDegree)
+    {
+        if (aSeries.theCoefficients[myDegree] != theZero)
+        {
+            theCoefficients[myDegree] -= aSeries.theCoefficients[myDegree];
+        }
+    }
+    return *this;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::operator*=(const BasicPowerSeries& aSeries)
+    -> BasicPowerSeries&
+{
+    checkOrder(aSeries);
+    const auto myTimer = stats::ScopedTimer{stats::Phase::PolynomialMultiplication};
+    const auto myOrder = theCoefficients.size();
+
+    // Zero coefficients are skipped on both sides, so sparse series such as f(t^k) multiply in
+    // time proportional to their non-zero terms
+    auto myNonZero = std::vector<std::size_t>{};
+    for (auto myDegree = 0uz; myDegree < myOrder; ++myDegree)
+    {
+        if (aSeries.theCoefficients[myDegree] != theZero)
+        {
+            myNonZero.push_back(myDegree);
+        }
+    }
+
+    auto myResult = std::vector<Coefficient>(myOrder, theZero);
+    for (auto myDegree = 0uz; myDegree < myOrder; ++myDegree)
+    {
+        const auto& myCoefficient = theCoefficients[myDegree];
+        if (myCoefficient == theZero)
+        {
+            continue;
+        }
+        for (const auto myOtherDegree : myNonZero)
+        {
+            if (myDegree + myOtherDegree >= myOrder)
+            {
+                break;
+            }
+            myResult[myDegree + myOtherDegree] +=
+                myCoefficient * aSeries.theCoefficients[myOtherDegree];
+        }
+    }
+    theCoefficients = std::move(myResult);
+    return *this;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::operator*=(const Coefficient& aScalar) -> BasicPowerSeries&
+{
+    for (auto& myCoefficient : theCoefficients)
+    {
+        myCoefficient *= aScalar;
+    }
+    return *this;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::operator+(const BasicPowerSeries& aSeries) const
+    -> BasicPowerSeries
+{
+    auto myResult = *this;
+    myResult += aSeries;
+    return myResult;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::operator-(const BasicPowerSeries& aSeries) const
+    -> BasicPowerSeries
+{
+    auto myResult = *this;
+    myResult -= aSeries;
+    return myResult;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::operator*(const BasicPowerSeries& aSeries) const
+    -> BasicPowerSeries
+{
+    auto myResult = *this;
+    myResult *= aSeries;
+    return myResult;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::operator*(const Coefficient& aScalar) const
+    -> BasicPowerSeries
+{
+    auto myResult = *this;
+    myResult *= aScalar;
+    return myResult;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::pow(std::uint64_t anExponent) const -> BasicPowerSeries
+{
+    auto myResult = one(order(), theZero);
+    auto myBase = *this;
+    while (anExponent > 0)
+    {
+        if (anExponent % 2 == 1)
+        {
+            myResult *= myBase;
+        }
+        anExponent /= 2;
+        if (anExponent > 0)
+        {
+            myBase *= myBase;
+        }
+    }
+    return myResult;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::substitutePower(Power aPower) const -> BasicPowerSeries
+{
+    ensure(aPower.get() > 0, "Expected a positive power of t to substitute");
+    auto myResult = BasicPowerSeries{order(), theZero};
+    for (auto myDegree = 0uz; myDegree * aPower.get() < theCoefficients.size(); ++myDegree)
+    {
+        myResult.theCoefficients[myDegree * aPower.get()] = theCoefficients[myDegree];
+    }
+    return myResult;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::derivative() const -> BasicPowerSeries
+{
+    auto myResult = BasicPowerSeries{order(), theZero};
+    for (auto myDegree = 1uz; myDegree < theCoefficients.size(); ++myDegree)
+    {
+        myResult.theCoefficients[myDegree - 1] =
+            theCoefficients[myDegree] * integer(theZero, myDegree);
+    }
+    return myResult;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::integral() const -> BasicPowerSeries
+{
+    auto myResult = BasicPowerSeries{order(), theZero};
+    for (auto myDegree = 1uz; myDegree < theCoefficients.size(); ++myDegree)
+    {
+        myResult.theCoefficients[myDegree] =
+            theCoefficients[myDegree - 1] / integer(theZero, myDegree);
+    }
+    return myResult;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::exp() const -> BasicPowerSeries
+{
+    ensure(coefficient(0) == theZero, "Expected a zero constant term to take exp");
+    // n b_n = sum_{k = 1}^n k a_k b_{n - k}, from b' = a' b
+    auto myResult = one(order(), theZero);
+    for (auto myDegree = 1uz; myDegree < theCoefficients.size(); ++myDegree)
+    {
+        auto mySum = theZero;
+        for (auto myIndex = 1uz; myIndex <= myDegree; ++myIndex)
+        {
+            if (theCoefficients[myIndex] != theZero)
+            {
+                mySum += integer(theZero, myIndex) * theCoefficients[myIndex]
+                         * myResult.theCoefficients[myDegree - myIndex];
+            }
+        }
+        myResult.theCoefficients[myDegree] = mySum / integer(theZero, myDegree);
+    }
+    return myResult;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::log() const -> BasicPowerSeries
+{
+    ensure(coefficient(0) == integer(theZero, 1), "Expected a constant term of one to take log");
+    // n c_n = n a_n - sum_{k = 1}^{n - 1} k c_k a_{n - k}, from a' = c' a
+    auto myResult = BasicPowerSeries{order(), theZero};
+    for (auto myDegree = 1uz; myDegree < theCoefficients.size(); ++myDegree)
+    {
+        auto mySum = integer(theZero, myDegree) * theCoefficients[myDegree];
+        for (auto myIndex = 1uz; myIndex < myDegree; ++myIndex)
+        {
+            if (theCoefficients[myDegree - myIndex] != theZero)
+            {
+                mySum -= integer(theZero, myIndex) * myResult.theCoefficients[myIndex]
+                         * theCoefficients[myDegree - myIndex];
+            }
+        }
+        myResult.theCoefficients[myDegree] = mySum / integer(theZero, myDegree);
+    }
+    return myResult;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::operator==(const BasicPowerSeries& aSeries) const -> bool
+{
+    return theCoefficients == aSeries.theCoefficients;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::toString() const -> std::string
+{
+    auto myString = std::string{};
+    for (const auto& [myDegree, myCoefficient] : theCoefficients | views::enumerate)
+    {
+        if (myCoefficient == theZero)
+        {
+            continue;
+        }
+        myString += myString.empty() ? "+" : " +";
+        myString += myCoefficient.toString();
+        if (myDegree > 0)
+        {
+            myString += "t^" + std::to_string(myDegree);
+        }
+    }
+    return (myString.empty() ? "0" : myString) + " + O(t^" + std::to_string(order().get()) + ')';
+}
+
+template <typename Coefficient>
+auto operator<<(std::ostream& aStream, const BasicPowerSeries<Coefficient>& aSeries)
+    -> std::ostream&
+{
+    return aStream << aSeries.toString();
+}
+
+namespace
+{
+// Adds d a_d to c_m for every multiple m of d, so that c_n ends up as sum_{d | n} d a_d
+template <typename Coefficient>
+auto addToDivisorSums(
+    std::vector<Coefficient>& aDivisorSums, std::size_t aDivisor, const Coefficient& aCoefficient
+) -> void
+{
+    const auto myTerm = integer(aCoefficient, aDivisor) * aCoefficient;
+    for (auto myMultiple = aDivisor; myMultiple < aDivisorSums.size(); myMultiple += aDivisor)
+    {
+        aDivisorSums[myMultiple] += myTerm;
+    }
+}
+
+// The coefficient b_n of the Euler transform, from n b_n = sum_{k = 1}^n c_k b_{n - k}, where the
+// log of the transform has coefficients c_k / k
+template <typename Coefficient>
+auto eulerCoefficient(
+    const std::vector<Coefficient>& aDivisorSums, const BasicPowerSeries<Coefficient>& aResult,
+    std::size_t aDegree
+) -> Coefficient
+{
+    const auto& myZero = aResult.zero();
+    auto mySum = myZero;
+    for (auto myIndex = 1uz; myIndex <= aDegree; ++myIndex)
+    {
+        if (aDivisorSums[myIndex] != myZero)
+        {
+            mySum += aDivisorSums[myIndex] * aResult.coefficient(aDegree - myIndex);
+        }
+    }
+    return mySum / integer(myZero, aDegree);
+}
+} // namespace
+
+template <typename Coefficient>
+auto eulerTransform(const BasicPowerSeries<Coefficient>& aSeries) -> BasicPowerSeries<Coefficient>
+{
+    const auto& myZero = aSeries.zero();
+    ensure(
+        aSeries.coefficient(0) == myZero, "Expected a zero constant term for the Euler transform"
+    );
+    const auto myOrder = aSeries.order().get();
+
+    auto myDivisorSums = std::vector<Coefficient>(myOrder, myZero);
+    for (auto myDivisor = 1uz; myDivisor < myOrder; ++myDivisor)
+    {
+        if (aSeries.coefficient(myDivisor) != myZero)
+        {
+            addToDivisorSums(myDivisorSums, myDivisor, aSeries.coefficient(myDivisor));
+        }
+    }
+
+    auto myResult = BasicPowerSeries<Coefficient>::one(aSeries.order(), myZero);
+    for (auto myDegree = 1uz; myDegree < myOrder; ++myDegree)
+    {
+        myResult.set(myDegree, eulerCoefficient(myDivisorSums, myResult, myDegree));
+    }
+    return myResult;
+}
+
+template <typename Coefficient>
+auto eulerFixedPoint(const BasicPowerSeries<Coefficient>& aSeed) -> BasicPowerSeries<Coefficient>
+{
+    const auto& myZero = aSeed.zero();
+    ensure(aSeed.coefficient(0) == myZero, "Expected a seed with a zero constant term");
+    const auto myOrder = aSeed.order().get();
+
+    // a_n = sum_{j = 1}^n s_j b_{n - j} needs the transform b up to n - 1, which needs a up to
+    // n - 1, so each round extends the transform by one coefficient and then A by one
+    auto mySolution = BasicPowerSeries<Coefficient>{aSeed.order(), myZero};
+    auto myTransform = BasicPowerSeries<Coefficient>::one(aSeed.order(), myZero);
+    auto myDivisorSums = std::vector<Coefficient>(myOrder, myZero);
+    for (auto myDegree = 1uz; myDegree < myOrder; ++myDegree)
+    {
+        if (myDegree > 1)
+        {
+            myTransform.set(
+                myDegree - 1, eulerCoefficient(myDivisorSums, myTransform, myDegree - 1)
+            );
+        }
+        auto myCoefficient = myZero;
+        for (auto mySeedDegree = 1uz; mySeedDegree <= myDegree; ++mySeedDegree)
+        {
+            if (aSeed.coefficient(mySeedDegree) != myZero)
+            {
+                myCoefficient += aSeed.coefficient(mySeedDegree)
+                                 * myTransform.coefficient(myDegree - mySeedDegree);
+            }
+        }
+        mySolution.set(myDegree, myCoefficient);
+        if (myCoefficient != myZero)
+        {
+            addToDivisorSums(myDivisorSums, myDegree, myCoefficient);
+        }
+    }
+    return mySolution;
+}
+
+template <typename Coefficient>
+auto BasicPowerSeries<Coefficient>::checkOrder(const BasicPowerSeries& aSeries) const -> void
+{
+    ensure(
+        aSeries.theCoefficients.size() == theCoefficients.size(),
+        "Cannot combine power series of orders {} and {}", theCoefficients.size(),
+        aSeries.theCoefficients.size()
+    );
+}
+
+template class BasicPowerSeries<Rational>;
+template class BasicPowerSeries<Modular>;
+template auto operator<<(std::ostream&, const PowerSeries&) -> std::ostream&;
+template auto operator<<(std::ostream&, const ModularPowerSeries&) -> std::ostream&;
+template auto eulerTransform(const PowerSeries&) -> PowerSeries;
+template auto eulerTransform(const ModularPowerSeries&) -> ModularPowerSeries;
+template auto eulerFixedPoint(const PowerSeries&) -> PowerSeries;
+template auto eulerFixedPoint(const ModularPowerSeries&) -> ModularPowerSeries;
+} // namespace polya
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "core/polya-enumeration/modular/Modular.hh"
+#include "core/polya-enumeration/rational/Rational.hh"
+#include "core/util/Type.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace polya
+{
+// A univariate power series a_0 + a_1 t + a_2 t^2 + ... truncated after t^(order - 1), stored as
+// a dense coefficient array. Operands of binary operations must have the same order.
+//
+// Coefficients are exact Rationals, or residues modulo a prime for sequences whose terms outgrow
+// 64 bits, e.g. the counts up to t^1000 of structures that grow exponentially. Modular series
+// take their modulus from the zero they are constructed with.
+template <typename Coefficient>
+class BasicPowerSeries
+{
+public:
+    using Order = Type<std::size_t, struct OrderTag>;
+    using Power = Type<std::uint32_t, struct PowerTag>;
+
+    explicit BasicPowerSeries(Order anOrder, Coefficient aZero = Coefficient{0}); // Zero
+    // Coefficients past the order are dropped and missing ones are zero
+    BasicPowerSeries(
+        std::vector<Coefficient> aCoefficients, Order anOrder, Coefficient aZero = Coefficient{0}
+    );
+
+    [[nodiscard]] static auto one(Order anOrder, Coefficient aZero = Coefficient{0})
+        -> BasicPowerSeries;
+
+    [[nodiscard]] auto order() const -> Order;
+    [[nodiscard]] auto zero() const -> const Coefficient&;
+    [[nodiscard]] auto coefficient(std::size_t aDegree) const -> Coefficient; // Zero past order
+    auto set(std::size_t aDegree, const Coefficient& aCoefficient) -> void;   // Ignored past it
+    [[nodiscard]] auto coefficients() const -> const std::vector<Coefficient>&;
+    [[nodiscard]] auto isZero() const -> bool;
+
+    auto operator+=(const BasicPowerSeries& aSeries) -> BasicPowerSeries&;
+    auto operator-=(const BasicPowerSeries& aSeries) -> BasicPowerSeries&;
+    auto operator*=(const BasicPowerSeries& aSeries) -> BasicPowerSeries&; // Truncated convolution
+    auto operator*=(const Coefficient& aScalar) -> BasicPowerSeries&;
+    [[nodiscard]] auto operator+(const BasicPowerSeries& aSeries) const -> BasicPowerSeries;
+    [[nodiscard]] auto operator-(const BasicPowerSeries& aSeries) const -> BasicPowerSeries;
+    [[nodiscard]] auto operator*(const BasicPowerSeries& aSeries) const -> BasicPowerSeries;
+    [[nodiscard]] auto operator*(const Coefficient& aScalar) const -> BasicPowerSeries;
+
+    [[nodiscard]] auto pow(std::uint64_t anExponent) const -> BasicPowerSeries; // By squaring
+    [[nodiscard]] auto substitutePower(Power aPower) const -> BasicPowerSeries; // f(t^k)
+
+    [[nodiscard]] auto derivative() const -> BasicPowerSeries; // Same order, top coefficient zero
+    [[nodiscard]] auto integral() const -> BasicPowerSeries;   // Zero constant term
+    // O(N^2) recurrences from f' = f * (log f)'. exp needs a zero constant term, log a constant
+    // term of one. Modular series also need a modulus that does not divide the degrees < N.
+    [[nodiscard]] auto exp() const -> BasicPowerSeries;
+    [[nodiscard]] auto log() const -> BasicPowerSeries;
+
+    [[nodiscard]] auto operator==(const BasicPowerSeries& aSeries) const -> bool;
+
+    [[nodiscard]] auto toString() const -> std::string;
+
+private:
+    auto checkOrder(const BasicPowerSeries& aSeries) const -> void;
+
+    Coefficient theZero; // Of the coefficient ring, e.g. carrying the modulus
+    std::vector<Coefficient> theCoefficients; // Exactly order() of them
+};
+
+template <typename Coefficient>
+auto operator<<(std::ostream& aStream, const BasicPowerSeries<Coefficient>& aSeries)
+    -> std::ostream&;
+
+// Both are instantiated in PowerSeries.cc
+using PowerSeries = BasicPowerSeries<Rational>;
+using ModularPowerSeries = BasicPowerSeries<Modular>;
+extern template class BasicPowerSeries<Rational>;
+extern template class BasicPowerSeries<Modular>;
+
+// The Euler transform exp(sum_k a(t^k) / k) of a series with a zero constant term: the multisets
+// of objects counted by a, i.e. the sum over n of Z(S_n)(a(t), a(t^2), ...). Computed without the
+// symmetric groups in O(N^2) from the divisor sums c_n = sum_{d | n} d a_d.
+template <typename Coefficient>
+[[nodiscard]] auto eulerTransform(const BasicPowerSeries<Coefficient>& aSeries)
+    -> BasicPowerSeries<Coefficient>;
+
+// The solution A of A = aSeed * eulerTransform(A) for a seed with a zero constant term, e.g. the
+// unlabelled rooted trees by number of nodes for aSeed = t. Each coefficient of A only depends on
+// lower ones, so A is built one coefficient at a time in O(N^2) rather than by iterating the
+// equation N times.
+template <typename Coefficient>
+[[nodiscard]] auto eulerFixedPoint(const BasicPowerSeries<Coefficient>& aSeed)
+    -> BasicPowerSeries<Coefficient>;
+} // namespace polya
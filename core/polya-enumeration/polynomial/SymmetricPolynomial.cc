@@ -0,0 +1,196 @@
+#include "core/polya-enumeration/polynomial/SymmetricPolynomial.hh"
+
+#include "core/util/Exception.hh"
+#include "core/util/Stats.hh"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <range/v3/all.hpp>
+#include <utility>
+
+namespace polya
+{
+namespace views = ranges::views;
+using Term = SymmetricPolynomial::Term;
+using Exponent = SymmetricPolynomial::Exponent;
+
+namespace
+{
+auto values(const Term& aTerm) -> std::vector<std::uint32_t>
+{
+    return aTerm.get() | views::transform(&Exponent::underlying)
+           | ranges::to<std::vector<std::uint32_t>>();
+}
+
+auto saturatingAdd(std::uint64_t aFirst, std::uint64_t aSecond) -> std::uint64_t
+{
+    auto myResult = std::uint64_t{0};
+    return __builtin_add_overflow(aFirst, aSecond, &myResult)
+               ? std::numeric_limits<std::uint64_t>::max()
+               : myResult;
+}
+} // namespace
+
+auto SymmetricPolynomial::TermComparator::operator()(
+    const Term& aFirstTerm, const Term& aSecondTerm
+) const noexcept -> bool
+{
+    return ranges::lexicographical_compare(
+        aFirstTerm.get() | views::transform(&Exponent::underlying),
+        aSecondTerm.get() | views::transform(&Exponent::underlying)
+    );
+}
+
+SymmetricPolynomial::SymmetricPolynomial(std::vector<VariableName> aVariableNames)
+    : theVariableNames{std::move(aVariableNames)}
+{
+}
+
+auto SymmetricPolynomial::fromPolynomial(const Polynomial& aPolynomial) -> SymmetricPolynomial
+{
+    auto myResult = SymmetricPolynomial{aPolynomial.variables()};
+    for (const auto& [myTerm, myCoefficient] : aPolynomial.terms())
+    {
+        const auto mySorted = sorted(myTerm);
+        ensure(
+            aPolynomial.coefficient(mySorted) == myCoefficient,
+            "Expected a symmetric polynomial, but {} and its permutations differ",
+            myCoefficient.toString()
+        );
+        myResult.theCoefficientMap.insert_or_assign(mySorted, myCoefficient);
+    }
+    // Every permutation of a term must be present, not only those with equal coefficients
+    ensure(
+        myResult.termCount() == aPolynomial.terms().size(),
+        "Expected a symmetric polynomial, but some permutations of its terms are missing"
+    );
+    return myResult;
+}
+
+auto SymmetricPolynomial::coefficient(const Term& aTerm) const -> Rational
+{
+    if (aTerm.get().size() != theVariableNames.size())
+    {
+        return Rational{0};
+    }
+    const auto myTerm = theCoefficientMap.find(sorted(aTerm));
+    return myTerm != theCoefficientMap.end() ? myTerm->second : Rational{0};
+}
+
+auto SymmetricPolynomial::set(const Term& aTerm, const Rational& aCoefficient) -> void
+{
+    ensure_debug(
+        aTerm.get().size() == theVariableNames.size(),
+        "Expected term with {} exponents, but received {}", theVariableNames.size(),
+        aTerm.get().size()
+    );
+    if (aCoefficient == Rational{0})
+    {
+        theCoefficientMap.erase(sorted(aTerm));
+        return;
+    }
+    theCoefficientMap.insert_or_assign(sorted(aTerm), aCoefficient);
+    stats::count(stats::Counter::MapInsertions);
+}
+
+auto SymmetricPolynomial::isZero() const -> bool
+{
+    return theCoefficientMap.empty();
+}
+
+auto SymmetricPolynomial::variables() const -> const std::vector<VariableName>&
+{
+    return theVariableNames;
+}
+
+auto SymmetricPolynomial::terms() const -> const std::map<Term, Rational, TermComparator>&
+{
+    return theCoefficientMap;
+}
+
+auto SymmetricPolynomial::termCount() const -> std::uint64_t
+{
+    return ranges::accumulate(
+        theCoefficientMap | views::keys | views::transform(&SymmetricPolynomial::orbitSize),
+        std::uint64_t{0}, &saturatingAdd
+    );
+}
+
+auto SymmetricPolynomial::orbitSize(const Term& aTerm) -> std::uint64_t
+{
+    // The multinomial K! / (r_1! * ... * r_m!) over the runs of equal exponents, built up one
+    // exponent at a time. Each prefix is itself a multinomial, so every division is exact.
+    const auto myValues = values(sorted(aTerm));
+    auto myResult = static_cast<unsigned __int128>(1);
+    auto myRun = 0u;
+    for (auto myIndex = 0uz; myIndex < myValues.size(); ++myIndex)
+    {
+        myRun = myIndex > 0 and myValues[myIndex] == myValues[myIndex - 1] ? myRun + 1 : 1;
+        myResult = myResult * (myIndex + 1) / myRun;
+        if (myResult > std::numeric_limits<std::uint64_t>::max())
+        {
+            return std::numeric_limits<std::uint64_t>::max();
+        }
+    }
+    return static_cast<std::uint64_t>(myResult);
+}
+
+auto SymmetricPolynomial::toPolynomial() const -> Polynomial
+{
+    auto myPolynomial = Polynomial{theVariableNames};
+    for (const auto& [myTerm, myCoefficient] : theCoefficientMap)
+    {
+        auto myValues = values(myTerm);
+        ranges::sort(myValues);
+        do
+        {
+            myPolynomial.setUnchecked(
+                Term{myValues | views::transform([](auto aValue) { return Exponent{aValue}; })
+                     | ranges::to<std::vector<Exponent>>()},
+                myCoefficient
+            );
+        } while (std::next_permutation(myValues.begin(), myValues.end()));
+    }
+    return myPolynomial;
+}
+
+auto SymmetricPolynomial::operator==(const SymmetricPolynomial& aPolynomial) const -> bool
+{
+    return theVariableNames == aPolynomial.theVariableNames
+           and theCoefficientMap == aPolynomial.theCoefficientMap;
+}
+
+auto SymmetricPolynomial::toString() const -> std::string
+{
+    if (isZero())
+    {
+        return "0";
+    }
+    return theCoefficientMap
+           | views::transform(
+               [](const auto& aPair)
+               {
+                   const auto& [myTerm, myCoefficient] = aPair;
+                   return '+' + myCoefficient.toString() + "m["
+                          + (myTerm.get()
+                             | views::transform([](const auto& anExponent)
+                                                { return std::to_string(anExponent.get()); })
+                             | views::join(',') | ranges::to<std::string>())
+                          + ']';
+               }
+           )
+           | views::join(' ') | ranges::to<std::string>();
+}
+
+auto operator<<(std::ostream& aStream, const SymmetricPolynomial& aPolynomial) -> std::ostream&
+{
+    return aStream << aPolynomial.toString();
+}
+
+auto SymmetricPolynomial::sorted(Term aTerm) -> Term
+{
+    ranges::sort(aTerm.get(), std::greater{}, &Exponent::underlying);
+    return aTerm;
+}
+} // namespace polya
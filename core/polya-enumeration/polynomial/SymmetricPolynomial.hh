@@ -0,0 +1,64 @@
+#pragma once
+
+#include "core/polya-enumeration/polynomial/Polynomial.hh"
+#include "core/polya-enumeration/rational/Rational.hh"
+
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace polya
+{
+// A polynomial unchanged by permuting its variables, such as a colour polynomial. Permuting the
+// exponents of a term gives a term with the same coefficient, so only the non-increasing
+// permutation of each term is stored: up to K! times fewer terms than the Polynomial in K
+// variables. Lookups sort the queried exponents.
+class SymmetricPolynomial
+{
+public:
+    using VariableName = Polynomial::VariableName;
+    using Exponent = Polynomial::Exponent;
+    using Term = Polynomial::Term;
+
+private:
+    struct TermComparator
+    {
+        auto operator()(const Term& aFirstTerm, const Term& aSecondTerm) const noexcept -> bool;
+    };
+
+public:
+    explicit SymmetricPolynomial(std::vector<VariableName> aVariableNames);
+
+    // Throws if aPolynomial is not symmetric
+    [[nodiscard]] static auto fromPolynomial(const Polynomial& aPolynomial)
+        -> SymmetricPolynomial;
+
+    [[nodiscard]] auto coefficient(const Term& aTerm) const -> Rational; // Of any permutation
+    auto set(const Term& aTerm, const Rational& aCoefficient) -> void;  // Of every permutation
+
+    [[nodiscard]] auto isZero() const -> bool;
+    [[nodiscard]] auto variables() const -> const std::vector<VariableName>&;
+    [[nodiscard]] auto terms() const -> const std::map<Term, Rational, TermComparator>&;
+    [[nodiscard]] auto termCount() const -> std::uint64_t; // Of toPolynomial(), saturating
+
+    // Distinct permutations of aTerm, saturating
+    [[nodiscard]] static auto orbitSize(const Term& aTerm) -> std::uint64_t;
+
+    [[nodiscard]] auto toPolynomial() const -> Polynomial; // Every permutation of every term
+
+    [[nodiscard]] auto operator==(const SymmetricPolynomial& aPolynomial) const -> bool;
+
+    // One m[e_1,...,e_K] per stored term, the sum of the permutations of c_1^e_1 * ... * c_K^e_K
+    [[nodiscard]] auto toString() const -> std::string;
+    friend auto operator<<(std::ostream& aStream, const SymmetricPolynomial& aPolynomial)
+        -> std::ostream&;
+
+private:
+    [[nodiscard]] static auto sorted(Term aTerm) -> Term;
+
+    std::vector<VariableName> theVariableNames;
+    std::map<Term, Rational, TermComparator> theCoefficientMap;
+};
+} // namespace polya
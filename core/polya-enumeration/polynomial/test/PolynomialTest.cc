@@ -229,6 +229,44 @@ TEST_F(PolynomialTest, MultiplyByRational)
     EXPECT_THAT(myResult, Eq(myPoly * Rational{16}));
 }
 
+TEST_F(PolynomialTest, MultiplyWithCapsDropsTermsAsTheyAreFormed)
+{
+    const auto myVariables = std::vector{VariableName{"x"}, VariableName{"y"}};
+    auto mySum = Polynomial{myVariables};
+    mySum.set(Term{std::vector{Exponent{1}, Exponent{0}}}, Rational{1});
+    mySum.set(Term{std::vector{Exponent{0}, Exponent{1}}}, Rational{1});
+
+    // (x + y)^3 with at most one x
+    auto myCapped = mySum;
+    const auto myCaps = Polynomial::Caps{{Exponent{1}, std::nullopt}, std::nullopt};
+    myCapped.multiply(mySum, myCaps).multiply(mySum, myCaps);
+    EXPECT_THAT(myCapped.toString(), Eq("+(1/1)y^3 +(3/1)x^1*y^2"));
+
+    auto myExpected = mySum * mySum * mySum;
+    EXPECT_THAT(myExpected.truncate(myCaps), Eq(myCapped));
+
+    // Total degree below that of every product
+    auto myTruncated = mySum;
+    myTruncated.multiply(mySum, Polynomial::Caps{{}, Exponent{1}});
+    EXPECT_THAT(myTruncated.isZero(), IsTrue());
+
+    EXPECT_THROW(
+        myTruncated.multiply(mySum, Polynomial::Caps{{Exponent{1}}, std::nullopt}),
+        std::runtime_error
+    );
+}
+
+TEST_F(PolynomialTest, TruncateKeepsAdmittedTerms)
+{
+    auto myPoly = Polynomial{std::vector{VariableName{"x"}, VariableName{"y"}}};
+    myPoly.set(Term{std::vector{Exponent{2}, Exponent{0}}}, Rational{1});
+    myPoly.set(Term{std::vector{Exponent{1}, Exponent{2}}}, Rational{2});
+    myPoly.set(Term{std::vector{Exponent{0}, Exponent{1}}}, Rational{3});
+
+    myPoly.truncate(Polynomial::Caps{{std::nullopt, Exponent{1}}, Exponent{2}});
+    EXPECT_THAT(myPoly.toString(), Eq("+(3/1)y^1 +(1/1)x^2"));
+}
+
 TEST_F(PolynomialTest, InvalidTermThrows)
 {
     auto myPoly = Polynomial{std::vector{VariableName{"x"}, VariableName{"y"}}};
@@ -0,0 +1,183 @@
+#include "core/polya-enumeration/modular/Modular.hh"
+#include "core/polya-enumeration/polynomial/PowerSeries.hh"
+#include "core/polya-enumeration/rational/Rational.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace polya::test
+{
+using namespace ::testing;
+using Order = PowerSeries::Order;
+using Modulus = Modular::Modulus;
+
+class PowerSeriesTest : public ::testing::Test
+{
+};
+
+TEST_F(PowerSeriesTest, ConstructorTruncatesAndPads)
+{
+    const auto mySeries = PowerSeries{std::vector{Rational{1}, Rational{2}, Rational{3}}, Order{2}};
+    EXPECT_THAT(mySeries.coefficients(), Eq(std::vector{Rational{1}, Rational{2}}));
+    EXPECT_THAT(mySeries.coefficient(5), Eq(Rational{0}));
+
+    const auto myPadded = PowerSeries{std::vector{Rational{1}}, Order{3}};
+    EXPECT_THAT(myPadded.coefficients(), Eq(std::vector{Rational{1}, Rational{0}, Rational{0}}));
+    EXPECT_THAT(PowerSeries{Order{4}}.isZero(), IsTrue());
+}
+
+TEST_F(PowerSeriesTest, MultiplicationIsTruncated)
+{
+    const auto myOnePlusT = PowerSeries{std::vector{Rational{1}, Rational{1}}, Order{3}};
+    EXPECT_THAT(
+        (myOnePlusT * myOnePlusT).coefficients(),
+        Eq(std::vector{Rational{1}, Rational{2}, Rational{1}})
+    );
+    EXPECT_THAT(
+        myOnePlusT.pow(5).coefficients(), Eq(std::vector{Rational{1}, Rational{5}, Rational{10}})
+    );
+    EXPECT_THAT(myOnePlusT.pow(0), Eq(PowerSeries::one(Order{3})));
+}
+
+TEST_F(PowerSeriesTest, SubstitutePower)
+{
+    const auto mySeries =
+        PowerSeries{std::vector{Rational{1}, Rational{2}, Rational{3}, Rational{4}}, Order{7}};
+    EXPECT_THAT(
+        mySeries.substitutePower(PowerSeries::Power{3}).coefficients(),
+        Eq(std::vector{
+            Rational{1}, Rational{0}, Rational{0}, Rational{2}, Rational{0}, Rational{0},
+            Rational{3}})
+    );
+    EXPECT_THAT(mySeries.substitutePower(PowerSeries::Power{1}), Eq(mySeries));
+}
+
+TEST_F(PowerSeriesTest, ArithmeticAndToString)
+{
+    auto mySeries = PowerSeries{std::vector{Rational{1}, Rational{0}, Rational{2}}, Order{3}};
+    EXPECT_THAT(mySeries.toString(), Eq("+(1/1) +(2/1)t^2 + O(t^3)"));
+    EXPECT_THAT((mySeries - mySeries).toString(), Eq("0 + O(t^3)"));
+
+    mySeries += PowerSeries::one(Order{3});
+    mySeries *= Rational{Rational::Numerator{1}, Rational::Denominator{2}};
+    EXPECT_THAT(
+        mySeries.coefficients(), Eq(std::vector{Rational{1}, Rational{0}, Rational{1}})
+    );
+    EXPECT_THROW(mySeries += PowerSeries{Order{2}}, std::runtime_error);
+}
+
+TEST_F(PowerSeriesTest, ExpAndLogAreInverse)
+{
+    const auto myT = PowerSeries{std::vector{Rational{0}, Rational{1}}, Order{5}};
+    EXPECT_THAT(
+        myT.exp().coefficients(),
+        Eq(std::vector{
+            Rational{1}, Rational{1}, Rational{Rational::Numerator{1}, Rational::Denominator{2}},
+            Rational{Rational::Numerator{1}, Rational::Denominator{6}},
+            Rational{Rational::Numerator{1}, Rational::Denominator{24}}})
+    );
+
+    const auto mySeries =
+        PowerSeries{std::vector{Rational{0}, Rational{2}, Rational{-1}, Rational{3}}, Order{8}};
+    EXPECT_THAT(mySeries.exp().log(), Eq(mySeries));
+    EXPECT_THAT(
+        PowerSeries::one(Order{8}) + (mySeries.exp() * mySeries.derivative()).integral(),
+        Eq(mySeries.exp())
+    );
+    EXPECT_THAT(mySeries.derivative().integral(), Eq(mySeries));
+    EXPECT_THROW((void)PowerSeries::one(Order{3}).exp(), std::runtime_error);
+    EXPECT_THROW((void)mySeries.log(), std::runtime_error);
+}
+
+TEST_F(PowerSeriesTest, EulerTransformCountsMultisets)
+{
+    // One object of each positive weight: multisets are partitions
+    auto myOnes = PowerSeries{Order{12}};
+    for (auto myDegree = 1uz; myDegree < 12; ++myDegree)
+    {
+        myOnes.set(myDegree, Rational{1});
+    }
+    EXPECT_THAT(
+        eulerTransform(myOnes).coefficients(),
+        Eq(std::vector{
+            Rational{1}, Rational{1}, Rational{2}, Rational{3}, Rational{5}, Rational{7},
+            Rational{11}, Rational{15}, Rational{22}, Rational{30}, Rational{42}, Rational{56}})
+    );
+
+    // Unlabeled rooted trees by number of nodes, A = t * MSET(A), one coefficient per iteration
+    const auto myT = PowerSeries{std::vector{Rational{0}, Rational{1}}, Order{16}};
+    auto myTrees = PowerSeries{Order{16}};
+    for (auto myIteration = 0uz; myIteration < 16; ++myIteration)
+    {
+        myTrees = eulerTransform(myTrees) * myT;
+    }
+    EXPECT_THAT(
+        myTrees.coefficients(),
+        Eq(std::vector{
+            Rational{0}, Rational{1}, Rational{1}, Rational{2}, Rational{4}, Rational{9},
+            Rational{20}, Rational{48}, Rational{115}, Rational{286}, Rational{719},
+            Rational{1842}, Rational{4766}, Rational{12486}, Rational{32973}, Rational{87811}})
+    );
+}
+
+TEST_F(PowerSeriesTest, EulerFixedPointCountsRootedTrees)
+{
+    const auto myT = PowerSeries{std::vector{Rational{0}, Rational{1}}, Order{16}};
+    auto myIterated = PowerSeries{Order{16}};
+    for (auto myIteration = 0uz; myIteration < 16; ++myIteration)
+    {
+        myIterated = eulerTransform(myIterated) * myT;
+    }
+    EXPECT_THAT(eulerFixedPoint(myT), Eq(myIterated));
+
+    // Rooted trees whose nodes weigh 1 or 2, by total weight
+    const auto mySeed = PowerSeries{std::vector{Rational{0}, Rational{1}, Rational{1}}, Order{6}};
+    auto myPlanted = PowerSeries{Order{6}};
+    for (auto myIteration = 0uz; myIteration < 6; ++myIteration)
+    {
+        myPlanted = eulerTransform(myPlanted) * mySeed;
+    }
+    EXPECT_THAT(eulerFixedPoint(mySeed), Eq(myPlanted));
+    EXPECT_THROW((void)eulerFixedPoint(PowerSeries::one(Order{4})), std::runtime_error);
+}
+
+TEST_F(PowerSeriesTest, ModularSeriesMatchExactCoefficients)
+{
+    const auto myModulus = Modulus{998244353};
+    const auto myZero = Modular{0, myModulus};
+    auto myOnes = ModularPowerSeries{Order{12}, myZero};
+    for (auto myDegree = 1uz; myDegree < 12; ++myDegree)
+    {
+        myOnes.set(myDegree, Modular{1, myModulus});
+    }
+    const auto myPartitions = eulerTransform(myOnes);
+    EXPECT_THAT(myPartitions.coefficient(11), Eq(Modular{56, myModulus}));
+    EXPECT_THAT(myPartitions.log().exp(), Eq(myPartitions));
+    EXPECT_THAT(myOnes.exp().log(), Eq(myOnes));
+    EXPECT_THAT(myOnes.derivative().integral(), Eq(myOnes));
+
+    // Operands must share the modulus
+    EXPECT_THROW(
+        myOnes += ModularPowerSeries(Order{12}, Modular{0, Modulus{7}}), std::runtime_error
+    );
+}
+
+TEST_F(PowerSeriesTest, ModularRootedTreesPast64Bits)
+{
+    // The number of rooted trees on 1000 nodes has 466 digits; its residues are from an exact
+    // big integer evaluation of the same recurrence
+    const auto myOrder = Order{1001};
+    for (const auto& [myModulus, myResidue] :
+         {std::pair{998244353u, 91803769u}, std::pair{2147483647u, 1432030263u}})
+    {
+        const auto myZero = Modular{0, Modulus{myModulus}};
+        const auto myT = ModularPowerSeries{
+            std::vector{myZero, Modular{1, Modulus{myModulus}}}, myOrder, myZero};
+        const auto myTrees = eulerFixedPoint(myT);
+        EXPECT_THAT(myTrees.coefficient(11), Eq(Modular{1842, Modulus{myModulus}}));
+        EXPECT_THAT(myTrees.coefficient(1000).value(), Eq(myResidue));
+    }
+}
+} // namespace polya::test
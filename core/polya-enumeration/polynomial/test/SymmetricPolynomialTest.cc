@@ -0,0 +1,110 @@
+#include "core/polya-enumeration/polynomial/SymmetricPolynomial.hh"
+#include "core/polya-enumeration/polynomial/Polynomial.hh"
+#include "core/polya-enumeration/rational/Rational.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+namespace polya::test
+{
+using namespace ::testing;
+using VariableName = Polynomial::VariableName;
+using Exponent = Polynomial::Exponent;
+using Term = Polynomial::Term;
+
+class SymmetricPolynomialTest : public ::testing::Test
+{
+};
+
+TEST_F(SymmetricPolynomialTest, LooksUpAnyPermutation)
+{
+    auto myPoly = SymmetricPolynomial{
+        std::vector{VariableName{"x"}, VariableName{"y"}, VariableName{"z"}}};
+    myPoly.set(Term{std::vector{Exponent{1}, Exponent{3}, Exponent{2}}}, Rational{5});
+
+    EXPECT_THAT(myPoly.terms().size(), Eq(1uz));
+    EXPECT_THAT(
+        myPoly.terms().begin()->first, Eq(Term{std::vector{Exponent{3}, Exponent{2}, Exponent{1}}})
+    );
+    EXPECT_THAT(
+        myPoly.coefficient(Term{std::vector{Exponent{2}, Exponent{1}, Exponent{3}}}),
+        Eq(Rational{5})
+    );
+    EXPECT_THAT(
+        myPoly.coefficient(Term{std::vector{Exponent{2}, Exponent{2}, Exponent{2}}}),
+        Eq(Rational{0})
+    );
+    EXPECT_THAT(myPoly.coefficient(Term{std::vector{Exponent{3}, Exponent{3}}}), Eq(Rational{0}));
+
+    myPoly.set(Term{std::vector{Exponent{3}, Exponent{1}, Exponent{2}}}, Rational{0});
+    EXPECT_THAT(myPoly.isZero(), IsTrue());
+}
+
+TEST_F(SymmetricPolynomialTest, OrbitSizeIsMultinomial)
+{
+    EXPECT_THAT(
+        SymmetricPolynomial::orbitSize(Term{std::vector{Exponent{3}, Exponent{2}, Exponent{1}}}),
+        Eq(6u)
+    );
+    EXPECT_THAT(
+        SymmetricPolynomial::orbitSize(
+            Term{std::vector{Exponent{2}, Exponent{0}, Exponent{2}, Exponent{0}}}
+        ),
+        Eq(6u)
+    );
+    EXPECT_THAT(
+        SymmetricPolynomial::orbitSize(Term{std::vector{Exponent{4}, Exponent{4}}}), Eq(1u)
+    );
+    EXPECT_THAT(
+        SymmetricPolynomial::orbitSize(Term{std::vector<Exponent>(30, Exponent{0})}), Eq(1u)
+    );
+
+    auto myDistinct = std::vector<Exponent>{};
+    for (auto myIndex = 0u; myIndex < 30; ++myIndex)
+    {
+        myDistinct.emplace_back(myIndex);
+    }
+    EXPECT_THAT(
+        SymmetricPolynomial::orbitSize(Term{std::move(myDistinct)}),
+        Eq(std::numeric_limits<std::uint64_t>::max())
+    );
+}
+
+TEST_F(SymmetricPolynomialTest, RoundTripsThroughPolynomial)
+{
+    const auto myVariables = std::vector{VariableName{"x"}, VariableName{"y"}, VariableName{"z"}};
+    auto myPoly = SymmetricPolynomial{myVariables};
+    myPoly.set(Term{std::vector{Exponent{2}, Exponent{1}, Exponent{0}}}, Rational{3});
+    myPoly.set(Term{std::vector{Exponent{1}, Exponent{1}, Exponent{1}}}, Rational{7});
+
+    const auto myExpanded = myPoly.toPolynomial();
+    EXPECT_THAT(myExpanded.terms().size(), Eq(7uz));
+    EXPECT_THAT(myPoly.termCount(), Eq(7u));
+    EXPECT_THAT(
+        myExpanded.coefficient(Term{std::vector{Exponent{0}, Exponent{1}, Exponent{2}}}),
+        Eq(Rational{3})
+    );
+    EXPECT_THAT(SymmetricPolynomial::fromPolynomial(myExpanded), Eq(myPoly));
+}
+
+TEST_F(SymmetricPolynomialTest, RejectsAsymmetricPolynomials)
+{
+    auto myPoly = Polynomial{std::vector{VariableName{"x"}, VariableName{"y"}}};
+    myPoly.set(Term{std::vector{Exponent{2}, Exponent{1}}}, Rational{1});
+    EXPECT_THROW((void)SymmetricPolynomial::fromPolynomial(myPoly), std::runtime_error);
+
+    myPoly.set(Term{std::vector{Exponent{1}, Exponent{2}}}, Rational{2});
+    EXPECT_THROW((void)SymmetricPolynomial::fromPolynomial(myPoly), std::runtime_error);
+}
+
+TEST_F(SymmetricPolynomialTest, ToString)
+{
+    auto myPoly = SymmetricPolynomial{std::vector{VariableName{"x"}, VariableName{"y"}}};
+    EXPECT_THAT(myPoly.toString(), Eq("0"));
+    myPoly.set(Term{std::vector{Exponent{1}, Exponent{2}}}, Rational{4});
+    EXPECT_THAT(myPoly.toString(), Eq("+(4/1)m[2,1]"));
+}
+} // namespace polya::test
@@ -1,11 +1,53 @@
 #include "core/polya-enumeration/rational/Rational.hh"
 
 #include "core/util/Exception.hh"
+#include "core/util/Stats.hh"
 
 #include <numeric>
 
 namespace polya
 {
+namespace
+{
+// Results past 64 bits throw rather than wrap into a wrong count
+auto multiply(std::int64_t aFirst, std::int64_t aSecond) -> std::int64_t
+{
+    auto myResult = std::int64_t{0};
+    ensure(
+        not __builtin_mul_overflow(aFirst, aSecond, &myResult),
+        "Rational arithmetic overflows 64 bits: {} * {}", aFirst, aSecond
+    );
+    return myResult;
+}
+
+auto add(std::int64_t aFirst, std::int64_t aSecond) -> std::int64_t
+{
+    auto myResult = std::int64_t{0};
+    ensure(
+        not __builtin_add_overflow(aFirst, aSecond, &myResult),
+        "Rational arithmetic overflows 64 bits: {} + {}", aFirst, aSecond
+    );
+    return myResult;
+}
+
+auto subtract(std::int64_t aFirst, std::int64_t aSecond) -> std::int64_t
+{
+    auto myResult = std::int64_t{0};
+    ensure(
+        not __builtin_sub_overflow(aFirst, aSecond, &myResult),
+        "Rational arithmetic overflows 64 bits: {} - {}", aFirst, aSecond
+    );
+    return myResult;
+}
+
+// Sums are taken over the least common denominator, so that they only overflow when it does
+auto commonScale(std::int64_t aFirst, std::int64_t aSecond) -> std::int64_t
+{
+    stats::count(stats::Counter::GcdCalls);
+    return std::gcd(aFirst, aSecond);
+}
+} // namespace
+
 Rational::Rational(Numerator aNumerator, Denominator aDenominator)
     : theNumerator{aNumerator}, theDenominator{aDenominator}
 {
@@ -23,6 +65,7 @@ auto Rational::reduce() -> void
         theNumerator = Numerator{-theNumerator.get()};
         theDenominator = Denominator{-theDenominator.get()};
     }
+    stats::count(stats::Counter::GcdCalls);
     const auto myGcd = std::gcd(std::abs(theNumerator.get()), theDenominator.get());
     theNumerator = Numerator{theNumerator.get() / myGcd};
     theDenominator = Denominator{theDenominator.get() / myGcd};
@@ -30,9 +73,13 @@ auto Rational::reduce() -> void
 
 auto Rational::operator+=(const Rational& aRational) -> Rational&
 {
-    const auto myNumerator = theNumerator.get() * aRational.theDenominator.get()
-                             + aRational.theNumerator.get() * theDenominator.get();
-    const auto myDenominator = theDenominator.get() * aRational.theDenominator.get();
+    const auto myScale = commonScale(theDenominator.get(), aRational.theDenominator.get());
+    const auto myNumerator = add(
+        multiply(theNumerator.get(), aRational.theDenominator.get() / myScale),
+        multiply(aRational.theNumerator.get(), theDenominator.get() / myScale)
+    );
+    const auto myDenominator =
+        multiply(theDenominator.get(), aRational.theDenominator.get() / myScale);
     theNumerator = Numerator{myNumerator};
     theDenominator = Denominator{myDenominator};
     reduce();
@@ -41,9 +88,13 @@ auto Rational::operator+=(const Rational& aRational) -> Rational&
 
 auto Rational::operator-=(const Rational& aRational) -> Rational&
 {
-    const auto myNumerator = theNumerator.get() * aRational.theDenominator.get()
-                             - aRational.theNumerator.get() * theDenominator.get();
-    const auto myDenominator = theDenominator.get() * aRational.theDenominator.get();
+    const auto myScale = commonScale(theDenominator.get(), aRational.theDenominator.get());
+    const auto myNumerator = subtract(
+        multiply(theNumerator.get(), aRational.theDenominator.get() / myScale),
+        multiply(aRational.theNumerator.get(), theDenominator.get() / myScale)
+    );
+    const auto myDenominator =
+        multiply(theDenominator.get(), aRational.theDenominator.get() / myScale);
     theNumerator = Numerator{myNumerator};
     theDenominator = Denominator{myDenominator};
     reduce();
@@ -52,8 +103,8 @@ auto Rational::operator-=(const Rational& aRational) -> Rational&
 
 auto Rational::operator*=(const Rational& aRational) -> Rational&
 {
-    theNumerator = Numerator{theNumerator.get() * aRational.theNumerator.get()};
-    theDenominator = Denominator{theDenominator.get() * aRational.theDenominator.get()};
+    theNumerator = Numerator{multiply(theNumerator.get(), aRational.theNumerator.get())};
+    theDenominator = Denominator{multiply(theDenominator.get(), aRational.theDenominator.get())};
     reduce();
     return *this;
 }
@@ -61,8 +112,8 @@ auto Rational::operator*=(const Rational& aRational) -> Rational&
 auto Rational::operator/=(const Rational& aRational) -> Rational&
 {
     ensure(aRational.theNumerator.get() != 0, "Cannot divide by zero");
-    theNumerator = Numerator{theNumerator.get() * aRational.theDenominator.get()};
-    theDenominator = Denominator{theDenominator.get() * aRational.theNumerator.get()};
+    theNumerator = Numerator{multiply(theNumerator.get(), aRational.theDenominator.get())};
+    theDenominator = Denominator{multiply(theDenominator.get(), aRational.theNumerator.get())};
     reduce();
     return *this;
 }
@@ -97,14 +148,15 @@ auto Rational::operator/(const Rational& aRational) const -> Rational
 
 auto Rational::operator==(const Rational& aRational) const -> bool
 {
-    return theNumerator.get() * aRational.theDenominator.get()
-           == aRational.theNumerator.get() * theDenominator.get();
+    // Exact in 128 bits, so comparisons never overflow
+    return static_cast<__int128>(theNumerator.get()) * aRational.theDenominator.get()
+           == static_cast<__int128>(aRational.theNumerator.get()) * theDenominator.get();
 }
 
 auto Rational::operator<=>(const Rational& aRational) const -> std::strong_ordering
 {
-    const auto myLhs = theNumerator.get() * aRational.theDenominator.get();
-    const auto myRhs = aRational.theNumerator.get() * theDenominator.get();
+    const auto myLhs = static_cast<__int128>(theNumerator.get()) * aRational.theDenominator.get();
+    const auto myRhs = static_cast<__int128>(aRational.theNumerator.get()) * theDenominator.get();
     return myLhs <=> myRhs;
 }
 
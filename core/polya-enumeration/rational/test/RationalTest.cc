@@ -3,6 +3,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <limits>
 #include <sstream>
 
 namespace polya::test
@@ -101,6 +103,12 @@ TEST_F(RationalTest, DivisionByZeroThrows)
     );
 }
 
+TEST_F(RationalTest, ZeroDenominatorThrows)
+{
+    auto myRational = Rational{Numerator{1}, Denominator{0}};
+    EXPECT_THROW(myRational.reduce(), std::runtime_error);
+}
+
 TEST_F(RationalTest, CompoundAssignment)
 {
     auto myRational = Rational{Numerator{1}, Denominator{2}};
@@ -126,6 +134,24 @@ TEST_F(RationalTest, Comparison)
     EXPECT_THAT(Rational(Numerator{1}, Denominator{2}), Gt(Rational(Numerator{1}, Denominator{3})));
 }
 
+TEST_F(RationalTest, OverflowThrows)
+{
+    const auto myLarge = Rational{std::numeric_limits<std::int64_t>::max() / 2 + 1};
+    EXPECT_THROW((void)(myLarge * Rational{2}), std::runtime_error);
+    EXPECT_THROW((void)(myLarge + myLarge), std::runtime_error);
+    EXPECT_THROW(
+        (void)(Rational(Numerator{1}, Denominator{std::int64_t{1} << 40})
+               + Rational(Numerator{1}, Denominator{(std::int64_t{1} << 40) - 1})),
+        std::runtime_error
+    );
+
+    // Comparisons cross-multiply exactly, so they never overflow
+    EXPECT_THAT(
+        myLarge,
+        Gt(Rational(Numerator{1}, Denominator{std::numeric_limits<std::int64_t>::max()}))
+    );
+}
+
 TEST_F(RationalTest, IsIntegral)
 {
     EXPECT_THAT(Rational{1}.isIntegral(), IsTrue());
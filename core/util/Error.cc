@@ -0,0 +1,41 @@
+#include "core/util/Error.hh"
+
+#include <format>
+
+namespace polya
+{
+auto Error::message() const -> std::string
+{
+    const auto [myFirst, mySecond] = theArguments;
+    switch (theCode)
+    {
+    case Code::EmptyGroup:
+        return "Group cannot be empty";
+    case Code::ElementDegreeMismatch:
+        return std::format("Element has degree {}, but the group has degree {}", myFirst, mySecond);
+    case Code::GeneratorDegreeMismatch:
+        return std::format(
+            "Generator has degree {}, but the group has degree {}", myFirst, mySecond
+        );
+    case Code::ElementOutOfDomain:
+        return std::format(
+            "Cycle element {} is not in the domain of permutation with degree {}", myFirst, mySecond
+        );
+    case Code::RepeatedElement:
+        return std::format(
+            "Cycle element {} appears more than once in permutation with degree {}", myFirst,
+            mySecond
+        );
+    case Code::VariableCountMismatch:
+        return std::format(
+            "Expected the number of variable names ({}) to match the degree ({})", myFirst, mySecond
+        );
+    case Code::ColourCountMismatch:
+        return std::format(
+            "Expected the number of colour names ({}) to match the colour count ({})", myFirst,
+            mySecond
+        );
+    }
+    return "Unknown error";
+}
+} // namespace polya
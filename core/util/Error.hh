@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <string>
+
+namespace polya
+{
+// A validation failure reported by the non-throwing entry points. Errors are a code plus up to two
+// integer arguments; the human readable detail is only formatted when message() is called.
+class Error
+{
+public:
+    enum class Code : std::uint8_t
+    {
+        EmptyGroup,
+        ElementDegreeMismatch,   // (element degree, group degree)
+        GeneratorDegreeMismatch, // (generator degree, group degree)
+        ElementOutOfDomain,      // (element, permutation degree)
+        RepeatedElement,         // (element, permutation degree)
+        VariableCountMismatch,   // (variable count, degree)
+        ColourCountMismatch,     // (colour name count, colour count)
+    };
+    using Argument = std::size_t;
+
+    constexpr explicit Error(Code aCode, Argument aFirst = 0, Argument aSecond = 0) noexcept
+        : theCode{aCode}, theArguments{aFirst, aSecond}
+    {
+    }
+
+    [[nodiscard]] constexpr auto code() const noexcept -> Code
+    {
+        return theCode;
+    }
+
+    [[nodiscard]] auto message() const -> std::string;
+
+    [[nodiscard]] auto operator==(const Error& anError) const -> bool = default;
+
+private:
+    Code theCode;
+    std::array<Argument, 2> theArguments;
+};
+
+template <typename T>
+using Expected = std::expected<T, Error>;
+} // namespace polya
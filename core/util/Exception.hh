@@ -4,7 +4,10 @@
 #include <source_location>
 #include <stdexcept>
 
+// Internal invariant checks (ensure_debug) are compiled out with --//core/util:checks=off
+#ifndef POLYA_UNCHECKED
 #define UTIL_DEBUG
+#endif
 
 namespace polya
 {
@@ -0,0 +1,68 @@
+#include "core/util/ExecutionContext.hh"
+
+#include <utility>
+
+namespace polya
+{
+Interrupted::Interrupted(Reason aReason, stats::Phase aPhase)
+    : std::runtime_error{
+          (aReason == Reason::Cancelled ? "Cancelled during " : "Deadline exceeded during ")
+          + stats::name(aPhase)},
+      theReason{aReason},
+      thePhase{aPhase}
+{
+}
+
+auto Interrupted::reason() const -> Reason
+{
+    return theReason;
+}
+
+auto Interrupted::phase() const -> stats::Phase
+{
+    return thePhase;
+}
+
+ExecutionContext::ExecutionContext(
+    std::stop_token aStopToken, std::optional<Clock::time_point> aDeadline,
+    ProgressCallback aProgress
+)
+    : theStopToken{std::move(aStopToken)},
+      theDeadline{aDeadline},
+      theProgress{std::move(aProgress)},
+      theLimited{theStopToken.stop_possible() or theDeadline or theProgress}
+{
+}
+
+auto ExecutionContext::unlimited() -> const ExecutionContext&
+{
+    static const auto theContext = ExecutionContext{};
+    return theContext;
+}
+
+auto ExecutionContext::stopToken() const -> const std::stop_token&
+{
+    return theStopToken;
+}
+
+auto ExecutionContext::deadline() const -> const std::optional<Clock::time_point>&
+{
+    return theDeadline;
+}
+
+auto ExecutionContext::check(const Progress& aProgress) const -> void
+{
+    if (theProgress)
+    {
+        theProgress(aProgress);
+    }
+    if (theStopToken.stop_requested())
+    {
+        throw Interrupted{Interrupted::Reason::Cancelled, aProgress.thePhase};
+    }
+    if (theDeadline and Clock::now() >= *theDeadline)
+    {
+        throw Interrupted{Interrupted::Reason::DeadlineExceeded, aProgress.thePhase};
+    }
+}
+} // namespace polya
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "core/util/Stats.hh"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <stop_token>
+
+namespace polya
+{
+// Thrown from a checkpoint when the computation was cancelled or ran past its deadline
+class Interrupted : public std::runtime_error
+{
+public:
+    enum class Reason : std::uint8_t
+    {
+        Cancelled,
+        DeadlineExceeded,
+    };
+
+    Interrupted(Reason aReason, stats::Phase aPhase);
+
+    [[nodiscard]] auto reason() const -> Reason;
+    [[nodiscard]] auto phase() const -> stats::Phase;
+
+private:
+    Reason theReason;
+    stats::Phase thePhase;
+};
+
+// Limits and observes a long computation: a stop token, a deadline and a progress callback,
+// consulted at checkpoints once per chunk of elements, cycle index term or multiplication row.
+// A context without any of them makes checkpoints a single branch.
+class ExecutionContext
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Progress
+    {
+        stats::Phase thePhase;
+        // Group elements (with the candidates of the current layer), cycle types, terms or rows
+        // done so far
+        std::size_t theProcessed;
+        std::size_t theTotal;     // Zero while unknown, e.g. during group generation
+    };
+    // May be called from several pool workers at once
+    using ProgressCallback = std::function<void(const Progress&)>;
+
+    ExecutionContext() = default; // Runs to completion
+    explicit ExecutionContext(
+        std::stop_token aStopToken,
+        std::optional<Clock::time_point> aDeadline = std::nullopt,
+        ProgressCallback aProgress = nullptr
+    );
+
+    [[nodiscard]] static auto unlimited() -> const ExecutionContext&;
+
+    // Reports progress, then throws Interrupted if a stop was requested or the deadline passed
+    auto checkpoint(stats::Phase aPhase, std::size_t aProcessed, std::size_t aTotal = 0) const
+        -> void
+    {
+        if (theLimited) [[unlikely]]
+        {
+            check(Progress{aPhase, aProcessed, aTotal});
+        }
+    }
+
+    [[nodiscard]] auto stopToken() const -> const std::stop_token&;
+    [[nodiscard]] auto deadline() const -> const std::optional<Clock::time_point>&;
+
+private:
+    auto check(const Progress& aProgress) const -> void;
+
+    std::stop_token theStopToken;
+    std::optional<Clock::time_point> theDeadline;
+    ProgressCallback theProgress;
+    bool theLimited = false;
+};
+} // namespace polya
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "core/util/Exception.hh"
 #include "core/util/Type.hh"
 
 #include <cstdint>
@@ -10,19 +11,29 @@ using Base = Type<std::uint32_t, struct BaseTag>;
 using Exponent = Type<std::uint32_t, struct ExponentTag>;
 using PowerResult = Type<std::uint64_t, struct ResultTag>;
 
-auto power(Base aBase, Exponent anExponent) -> PowerResult
+// Throws if the result does not fit in 64 bits rather than wrapping
+inline auto power(Base aBase, Exponent anExponent) -> PowerResult
 {
-    auto myResult = PowerResult{1};
-    while (anExponent.get() > 0)
+    auto myResult = std::uint64_t{1};
+    auto mySquare = std::uint64_t{aBase.get()};
+    for (auto myExponent = anExponent.get(); myExponent > 0; myExponent /= 2)
     {
-        if (anExponent.get() % 2 == 1)
+        if (myExponent % 2 == 1)
         {
-            myResult.get() *= aBase.get();
+            ensure(
+                not __builtin_mul_overflow(myResult, mySquare, &myResult),
+                "Expected {}^{} to fit in 64 bits", aBase.get(), anExponent.get()
+            );
+        }
+        // Squares are only taken when a higher bit uses them, so their overflow is the result's
+        if (myExponent > 1)
+        {
+            ensure(
+                not __builtin_mul_overflow(mySquare, mySquare, &mySquare),
+                "Expected {}^{} to fit in 64 bits", aBase.get(), anExponent.get()
+            );
         }
-        aBase.get() *= aBase.get();
-        anExponent.get() /= 2;
     }
-    return myResult;
+    return PowerResult{myResult};
 }
-
-} // namespace polya::mathutil
\ No newline at end of file
+} // namespace polya::mathutil
@@ -0,0 +1,188 @@
+#include "core/util/Stats.hh"
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace polya::stats
+{
+namespace
+{
+struct Totals
+{
+    std::array<std::uint64_t, theCounterCount> theCounts{};
+    std::array<std::uint64_t, thePhaseCount> thePhaseCalls{};
+    std::array<std::uint64_t, thePhaseCount> thePhaseNanoseconds{};
+
+    auto add(const detail::ThreadCounters& aCounters) -> void
+    {
+        for (auto myIndex = 0uz; myIndex < theCounterCount; ++myIndex)
+        {
+            theCounts[myIndex] += aCounters.theCounts[myIndex].load(std::memory_order_relaxed);
+        }
+        for (auto myIndex = 0uz; myIndex < thePhaseCount; ++myIndex)
+        {
+            thePhaseCalls[myIndex] +=
+                aCounters.thePhaseCalls[myIndex].load(std::memory_order_relaxed);
+            thePhaseNanoseconds[myIndex] +=
+                aCounters.thePhaseNanoseconds[myIndex].load(std::memory_order_relaxed);
+        }
+    }
+};
+
+struct Registry
+{
+    std::mutex theMutex;
+    std::vector<const detail::ThreadCounters*> theThreads;
+    Totals theRetired; // Counters of threads that have exited
+};
+
+// Never destroyed, so threads exiting during static destruction can still retire their counters
+auto registry() -> Registry&
+{
+    static auto* theRegistry = new Registry{};
+    return *theRegistry;
+}
+
+class ThreadRegistration
+{
+public:
+    ThreadRegistration()
+    {
+        auto& myRegistry = registry();
+        const auto myLock = std::scoped_lock{myRegistry.theMutex};
+        myRegistry.theThreads.push_back(&theCounters);
+    }
+
+    ~ThreadRegistration()
+    {
+        auto& myRegistry = registry();
+        const auto myLock = std::scoped_lock{myRegistry.theMutex};
+        myRegistry.theRetired.add(theCounters);
+        std::erase(myRegistry.theThreads, &theCounters);
+    }
+
+    ThreadRegistration(const ThreadRegistration&) = delete;
+    auto operator=(const ThreadRegistration&) -> ThreadRegistration& = delete;
+
+    detail::ThreadCounters theCounters;
+};
+} // namespace
+
+auto name(Counter aCounter) -> std::string
+{
+    switch (aCounter)
+    {
+    case Counter::PermutationProducts:
+        return "permutation products";
+    case Counter::GcdCalls:
+        return "gcd calls";
+    case Counter::PolynomialTermsCreated:
+        return "polynomial terms created";
+    case Counter::MapInsertions:
+        return "map insertions";
+    }
+    return "unknown counter";
+}
+
+auto name(Phase aPhase) -> std::string
+{
+    switch (aPhase)
+    {
+    case Phase::GroupGeneration:
+        return "group generation";
+    case Phase::CycleIndex:
+        return "cycle index";
+    case Phase::ColourEvaluation:
+        return "colour evaluation";
+    case Phase::PolynomialMultiplication:
+        return "polynomial multiplication";
+    case Phase::OrbitCounting:
+        return "orbit counting";
+    }
+    return "unknown phase";
+}
+
+auto Snapshot::count(Counter aCounter) const -> std::uint64_t
+{
+    return theCounts[static_cast<std::size_t>(aCounter)];
+}
+
+auto Snapshot::calls(Phase aPhase) const -> std::uint64_t
+{
+    return thePhaseCalls[static_cast<std::size_t>(aPhase)];
+}
+
+auto Snapshot::time(Phase aPhase) const -> std::chrono::nanoseconds
+{
+    return thePhaseTimes[static_cast<std::size_t>(aPhase)];
+}
+
+auto Snapshot::operator-(const Snapshot& aSnapshot) const -> Snapshot
+{
+    auto myResult = *this;
+    for (auto myIndex = 0uz; myIndex < theCounterCount; ++myIndex)
+    {
+        myResult.theCounts[myIndex] -= aSnapshot.theCounts[myIndex];
+    }
+    for (auto myIndex = 0uz; myIndex < thePhaseCount; ++myIndex)
+    {
+        myResult.thePhaseCalls[myIndex] -= aSnapshot.thePhaseCalls[myIndex];
+        myResult.thePhaseTimes[myIndex] -= aSnapshot.thePhaseTimes[myIndex];
+    }
+    return myResult;
+}
+
+auto Snapshot::toString() const -> std::string
+{
+    auto myString = std::string{};
+    for (auto myIndex = 0uz; myIndex < theCounterCount; ++myIndex)
+    {
+        myString += name(static_cast<Counter>(myIndex)) + ": " + std::to_string(theCounts[myIndex])
+                    + '\n';
+    }
+    for (auto myIndex = 0uz; myIndex < thePhaseCount; ++myIndex)
+    {
+        const auto myMicroseconds =
+            std::chrono::duration_cast<std::chrono::microseconds>(thePhaseTimes[myIndex]);
+        myString += name(static_cast<Phase>(myIndex)) + ": "
+                    + std::to_string(thePhaseCalls[myIndex]) + " calls, "
+                    + std::to_string(myMicroseconds.count()) + "us\n";
+    }
+    return myString;
+}
+
+auto operator<<(std::ostream& aStream, const Snapshot& aSnapshot) -> std::ostream&
+{
+    return aStream << aSnapshot.toString();
+}
+
+auto snapshot() -> Snapshot
+{
+    auto& myRegistry = registry();
+    const auto myLock = std::scoped_lock{myRegistry.theMutex};
+    auto myTotals = myRegistry.theRetired;
+    for (const auto* myCounters : myRegistry.theThreads)
+    {
+        myTotals.add(*myCounters);
+    }
+
+    auto mySnapshot = Snapshot{};
+    mySnapshot.theCounts = myTotals.theCounts;
+    mySnapshot.thePhaseCalls = myTotals.thePhaseCalls;
+    std::ranges::transform(
+        myTotals.thePhaseNanoseconds, mySnapshot.thePhaseTimes.begin(),
+        [](const auto aNanoseconds) { return std::chrono::nanoseconds{aNanoseconds}; }
+    );
+    return mySnapshot;
+}
+
+namespace detail
+{
+auto registerThread() -> ThreadCounters&
+{
+    thread_local auto theRegistration = ThreadRegistration{};
+    return theRegistration.theCounters;
+}
+} // namespace detail
+} // namespace polya::stats
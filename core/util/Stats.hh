@@ -0,0 +1,127 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+// Low overhead hot path counters and phase timers. Each thread writes its own counters with relaxed
+// atomics and snapshot() sums them. Build with --//core/util:stats=off to compile them out.
+namespace polya::stats
+{
+enum class Counter : std::size_t
+{
+    PermutationProducts,
+    GcdCalls,
+    PolynomialTermsCreated,
+    MapInsertions,
+};
+inline constexpr auto theCounterCount = 4uz;
+
+// Phases may nest (polynomial multiplication happens inside colour evaluation); times are inclusive
+enum class Phase : std::size_t
+{
+    GroupGeneration,
+    CycleIndex,
+    ColourEvaluation,
+    PolynomialMultiplication,
+    OrbitCounting,
+};
+inline constexpr auto thePhaseCount = 5uz;
+
+[[nodiscard]] auto name(Counter aCounter) -> std::string;
+[[nodiscard]] auto name(Phase aPhase) -> std::string;
+
+struct Snapshot
+{
+    std::array<std::uint64_t, theCounterCount> theCounts{};
+    std::array<std::uint64_t, thePhaseCount> thePhaseCalls{};
+    std::array<std::chrono::nanoseconds, thePhaseCount> thePhaseTimes{};
+
+    [[nodiscard]] auto count(Counter aCounter) const -> std::uint64_t;
+    [[nodiscard]] auto calls(Phase aPhase) const -> std::uint64_t;
+    [[nodiscard]] auto time(Phase aPhase) const -> std::chrono::nanoseconds;
+
+    [[nodiscard]] auto operator-(const Snapshot& aSnapshot) const -> Snapshot; // Activity between
+
+    [[nodiscard]] auto toString() const -> std::string;
+    friend auto operator<<(std::ostream& aStream, const Snapshot& aSnapshot) -> std::ostream&;
+};
+
+// Totals over all threads, including threads that have exited
+[[nodiscard]] auto snapshot() -> Snapshot;
+
+namespace detail
+{
+struct ThreadCounters
+{
+    std::array<std::atomic<std::uint64_t>, theCounterCount> theCounts{};
+    std::array<std::atomic<std::uint64_t>, thePhaseCount> thePhaseCalls{};
+    std::array<std::atomic<std::uint64_t>, thePhaseCount> thePhaseNanoseconds{};
+};
+
+[[nodiscard]] auto registerThread() -> ThreadCounters&;
+
+inline auto threadCounters() -> ThreadCounters&
+{
+    thread_local auto& theCounters = registerThread();
+    return theCounters;
+}
+
+// Only the owning thread writes, so a relaxed load and store avoids a locked read-modify-write
+inline auto add(std::atomic<std::uint64_t>& aValue, std::uint64_t anAmount) noexcept -> void
+{
+    aValue.store(aValue.load(std::memory_order_relaxed) + anAmount, std::memory_order_relaxed);
+}
+} // namespace detail
+
+inline auto count([[maybe_unused]] Counter aCounter, [[maybe_unused]] std::uint64_t anAmount = 1)
+    -> void
+{
+#ifndef POLYA_NO_STATS
+    detail::add(
+        detail::threadCounters().theCounts[static_cast<std::size_t>(aCounter)], anAmount
+    );
+#endif
+}
+
+// Adds the wall time of its scope to a phase
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer([[maybe_unused]] Phase aPhase)
+#ifndef POLYA_NO_STATS
+        : thePhase{aPhase}, theStart{std::chrono::steady_clock::now()}
+#endif
+    {
+    }
+
+    ~ScopedTimer()
+    {
+#ifndef POLYA_NO_STATS
+        const auto myElapsed = std::chrono::steady_clock::now() - theStart;
+        auto& myCounters = detail::threadCounters();
+        const auto myIndex = static_cast<std::size_t>(thePhase);
+        detail::add(myCounters.thePhaseCalls[myIndex], 1);
+        detail::add(
+            myCounters.thePhaseNanoseconds[myIndex],
+            static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(myElapsed).count()
+            )
+        );
+#endif
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    auto operator=(const ScopedTimer&) -> ScopedTimer& = delete;
+
+private:
+#ifndef POLYA_NO_STATS
+    Phase thePhase;
+    std::chrono::steady_clock::time_point theStart;
+#endif
+};
+} // namespace polya::stats
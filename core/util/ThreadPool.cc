@@ -0,0 +1,270 @@
+#include "core/util/ThreadPool.hh"
+
+#include "core/util/Exception.hh"
+
+#include <charconv>
+#include <cstdlib>
+#include <exception>
+#include <string_view>
+
+namespace polya
+{
+namespace
+{
+constexpr auto theSharedQueueCapacity = 1024uz;
+
+// The pool and deque index of the calling worker, if it is one
+thread_local const ThreadPool* theCurrentPool = nullptr;
+thread_local auto theCurrentWorker = 0uz;
+
+auto sharedWorkerCount() -> std::size_t
+{
+    if (const auto* myValue = std::getenv("POLYA_THREADS"); myValue != nullptr)
+    {
+        const auto myText = std::string_view{myValue};
+        auto myCount = 0uz;
+        const auto [myEnd, myError] =
+            std::from_chars(myText.data(), myText.data() + myText.size(), myCount);
+        ensure(
+            myError == std::errc{} and myEnd == myText.data() + myText.size() and myCount > 0,
+            "Expected POLYA_THREADS to be a positive integer, but received '{}'", myText
+        );
+        return myCount;
+    }
+    return std::max(std::size_t{std::thread::hardware_concurrency()}, 1uz);
+}
+
+struct ChunkState
+{
+    const std::function<void(std::size_t)>* theChunk;
+    std::size_t theCount;
+    std::atomic<std::size_t> theNext{0};
+    std::atomic<std::size_t> theDone{0};
+    std::atomic<bool> theFailed{false};
+    std::mutex theMutex;
+    std::exception_ptr theError;
+};
+
+// Claims chunks until none are left. Once a chunk has failed the rest are only counted, and a
+// helper that starts after every chunk is claimed returns without touching theChunk.
+auto runChunks(ChunkState& aState) -> void
+{
+    for (auto myIndex = aState.theNext.fetch_add(1); myIndex < aState.theCount;
+         myIndex = aState.theNext.fetch_add(1))
+    {
+        if (not aState.theFailed.load(std::memory_order_relaxed))
+        {
+            try
+            {
+                (*aState.theChunk)(myIndex);
+            }
+            catch (...)
+            {
+                const auto myLock = std::scoped_lock{aState.theMutex};
+                if (not aState.theError)
+                {
+                    aState.theError = std::current_exception();
+                }
+                aState.theFailed.store(true, std::memory_order_relaxed);
+            }
+        }
+        if (aState.theDone.fetch_add(1, std::memory_order_acq_rel) + 1 == aState.theCount)
+        {
+            aState.theDone.notify_all();
+        }
+    }
+}
+} // namespace
+
+ThreadPool::ThreadPool(std::size_t aWorkerCount, std::size_t aQueueCapacity)
+    : theQueueCapacity{aQueueCapacity}, thePending{0}
+{
+    ensure(aWorkerCount > 0, "A thread pool needs at least one worker");
+    ensure(aQueueCapacity > 0, "A thread pool needs a queue capacity of at least one");
+    theLocalQueues.reserve(aWorkerCount);
+    for (auto myIndex = 0uz; myIndex < aWorkerCount; ++myIndex)
+    {
+        theLocalQueues.push_back(std::make_unique<Worker>());
+    }
+    theWorkers.reserve(aWorkerCount);
+    for (auto myIndex = 0uz; myIndex < aWorkerCount; ++myIndex)
+    {
+        theWorkers.emplace_back([this, myIndex] { work(myIndex); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        const auto myLock = std::scoped_lock{theMutex};
+        theStopping = true;
+    }
+    theTaskAdded.notify_all();
+    theWorkers.clear();
+}
+
+auto ThreadPool::shared() -> ThreadPool&
+{
+    static auto thePool = ThreadPool{sharedWorkerCount(), theSharedQueueCapacity};
+    return thePool;
+}
+
+auto ThreadPool::submit(Task aTask) -> void
+{
+    push(aTask, true);
+}
+
+auto ThreadPool::trySubmit(Task& aTask) -> bool
+{
+    return push(aTask, false);
+}
+
+auto ThreadPool::workerCount() const -> std::size_t
+{
+    return theWorkers.size();
+}
+
+auto ThreadPool::queueCapacity() const -> std::size_t
+{
+    return theQueueCapacity;
+}
+
+auto ThreadPool::queued() const -> std::size_t
+{
+    return thePending.load(std::memory_order_relaxed);
+}
+
+auto ThreadPool::push(Task& aTask, bool aWait) -> bool
+{
+    if (theCurrentPool == this)
+    {
+        auto& myWorker = *theLocalQueues[theCurrentWorker];
+        {
+            // Counted before a thief can take it, and under theMutex for the waiting workers
+            const auto myLock = std::scoped_lock{theMutex, myWorker.theMutex};
+            thePending.fetch_add(1, std::memory_order_relaxed);
+            myWorker.theTasks.push_back(std::move(aTask));
+        }
+        theTaskAdded.notify_one();
+        return true;
+    }
+
+    {
+        auto myLock = std::unique_lock{theMutex};
+        if (not aWait and theQueue.size() >= theQueueCapacity)
+        {
+            return false;
+        }
+        theTaskTaken.wait(myLock, [this] { return theQueue.size() < theQueueCapacity; });
+        theQueue.push_back(std::move(aTask));
+        thePending.fetch_add(1, std::memory_order_relaxed);
+    }
+    theTaskAdded.notify_one();
+    return true;
+}
+
+// Own deque newest first, then the shared queue, then the oldest task of another worker
+auto ThreadPool::take(std::size_t aWorkerIndex) -> std::optional<Task>
+{
+    {
+        auto& myWorker = *theLocalQueues[aWorkerIndex];
+        const auto myLock = std::scoped_lock{myWorker.theMutex};
+        if (not myWorker.theTasks.empty())
+        {
+            auto myTask = std::move(myWorker.theTasks.back());
+            myWorker.theTasks.pop_back();
+            thePending.fetch_sub(1, std::memory_order_relaxed);
+            return myTask;
+        }
+    }
+    {
+        auto myLock = std::unique_lock{theMutex};
+        if (not theQueue.empty())
+        {
+            auto myTask = std::move(theQueue.front());
+            theQueue.pop_front();
+            thePending.fetch_sub(1, std::memory_order_relaxed);
+            myLock.unlock();
+            theTaskTaken.notify_one();
+            return myTask;
+        }
+    }
+    for (auto myOffset = 1uz; myOffset < theLocalQueues.size(); ++myOffset)
+    {
+        auto& myVictim = *theLocalQueues[(aWorkerIndex + myOffset) % theLocalQueues.size()];
+        const auto myLock = std::scoped_lock{myVictim.theMutex};
+        if (not myVictim.theTasks.empty())
+        {
+            auto myTask = std::move(myVictim.theTasks.front());
+            myVictim.theTasks.pop_front();
+            thePending.fetch_sub(1, std::memory_order_relaxed);
+            return myTask;
+        }
+    }
+    return std::nullopt;
+}
+
+auto ThreadPool::work(std::size_t aWorkerIndex) -> void
+{
+    theCurrentPool = this;
+    theCurrentWorker = aWorkerIndex;
+    while (true)
+    {
+        if (auto myTask = take(aWorkerIndex))
+        {
+            (*myTask)();
+            continue;
+        }
+        auto myLock = std::unique_lock{theMutex};
+        theTaskAdded.wait(
+            myLock, [this] { return theStopping or thePending.load(std::memory_order_relaxed) > 0; }
+        );
+        if (theStopping and thePending.load(std::memory_order_relaxed) == 0)
+        {
+            return; // Everything queued has run
+        }
+    }
+}
+
+namespace detail
+{
+auto forEachChunk(
+    ThreadPool& aPool, std::size_t aChunkCount, const std::function<void(std::size_t)>& aChunk
+) -> void
+{
+    if (aChunkCount <= 1)
+    {
+        if (aChunkCount == 1)
+        {
+            aChunk(0);
+        }
+        return;
+    }
+
+    const auto myState = std::make_shared<ChunkState>();
+    myState->theChunk = &aChunk;
+    myState->theCount = aChunkCount;
+    const auto myHelperCount = std::min(aPool.workerCount(), aChunkCount - 1);
+    for (auto myIndex = 0uz; myIndex < myHelperCount; ++myIndex)
+    {
+        auto myHelper = ThreadPool::Task{[myState] { runChunks(*myState); }};
+        if (not aPool.trySubmit(myHelper))
+        {
+            break; // The pool is saturated; the caller runs the remaining chunks
+        }
+    }
+    runChunks(*myState);
+
+    // Chunks claimed by helpers are already running, so this wait is short
+    for (auto myDone = myState->theDone.load(std::memory_order_acquire); myDone != aChunkCount;
+         myDone = myState->theDone.load(std::memory_order_acquire))
+    {
+        myState->theDone.wait(myDone, std::memory_order_acquire);
+    }
+    if (myState->theError)
+    {
+        std::rethrow_exception(myState->theError);
+    }
+}
+} // namespace detail
+} // namespace polya
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace polya
+{
+// A work-stealing task scheduler. Each worker owns a deque: tasks submitted by a worker go on its
+// own deque and are run newest first, and idle workers steal the oldest tasks from the others.
+// Tasks from other threads go through a bounded queue, and submit() blocks while it is full, so
+// producers cannot run arbitrarily far ahead of the workers.
+class ThreadPool
+{
+public:
+    using Task = std::move_only_function<void()>; // Must not throw
+
+    ThreadPool(std::size_t aWorkerCount, std::size_t aQueueCapacity);
+    ~ThreadPool(); // Runs the tasks already queued, then joins the workers
+
+    ThreadPool(const ThreadPool&) = delete;
+    auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+
+    // Shared by the whole library and created on first use, with POLYA_THREADS workers or one
+    // per hardware thread
+    [[nodiscard]] static auto shared() -> ThreadPool&;
+
+    auto submit(Task aTask) -> void;                    // Blocks while the queue is full
+    [[nodiscard]] auto trySubmit(Task& aTask) -> bool; // Leaves the task if the queue is full
+
+    [[nodiscard]] auto workerCount() const -> std::size_t;
+    [[nodiscard]] auto queueCapacity() const -> std::size_t;
+    [[nodiscard]] auto queued() const -> std::size_t; // Tasks waiting for a worker
+
+private:
+    struct Worker
+    {
+        std::mutex theMutex;
+        std::deque<Task> theTasks;
+    };
+
+    auto push(Task& aTask, bool aWait) -> bool;
+    auto take(std::size_t aWorkerIndex) -> std::optional<Task>;
+    auto work(std::size_t aWorkerIndex) -> void;
+
+    std::size_t theQueueCapacity;
+    mutable std::mutex theMutex;
+    std::condition_variable theTaskAdded;
+    std::condition_variable theTaskTaken;
+    std::deque<Task> theQueue;           // Tasks from threads outside the pool
+    std::atomic<std::size_t> thePending; // Tasks in any queue; only raised under theMutex
+    bool theStopping = false;
+    std::vector<std::unique_ptr<Worker>> theLocalQueues;
+    std::vector<std::jthread> theWorkers;
+};
+
+namespace detail
+{
+// Runs aChunk(i) for every i < aChunkCount, on the calling thread and any idle workers
+auto forEachChunk(
+    ThreadPool& aPool, std::size_t aChunkCount, const std::function<void(std::size_t)>& aChunk
+) -> void;
+} // namespace detail
+
+// Calls aBody(b, e) on disjoint chunks [b, e) covering [aBegin, anEnd), each at most aGrain long.
+// The caller works on chunks too and returns once all are done, so calls can be nested inside
+// pool tasks without deadlock. Rethrows the first exception thrown by aBody.
+template <typename Body>
+auto parallelFor(
+    std::size_t aBegin,
+    std::size_t anEnd,
+    std::size_t aGrain,
+    Body&& aBody,
+    ThreadPool& aPool = ThreadPool::shared()
+) -> void
+{
+    if (aBegin >= anEnd)
+    {
+        return;
+    }
+    const auto myGrain = std::max(aGrain, 1uz);
+    detail::forEachChunk(
+        aPool, (anEnd - aBegin + myGrain - 1) / myGrain,
+        [&](std::size_t aChunkIndex)
+        {
+            const auto myBegin = aBegin + aChunkIndex * myGrain;
+            aBody(myBegin, std::min(myBegin + myGrain, anEnd));
+        }
+    );
+}
+
+// Maps each chunk of [aBegin, anEnd) to aMap(b, e), then folds the results into anIdentity with
+// aCombine(T&&, T&&) -> T in chunk order, so the result does not depend on the schedule
+template <typename T, typename Map, typename Combine>
+auto parallelReduce(
+    std::size_t aBegin,
+    std::size_t anEnd,
+    std::size_t aGrain,
+    T anIdentity,
+    Map&& aMap,
+    Combine&& aCombine,
+    ThreadPool& aPool = ThreadPool::shared()
+) -> T
+{
+    if (aBegin >= anEnd)
+    {
+        return anIdentity;
+    }
+    const auto myGrain = std::max(aGrain, 1uz);
+    auto myResults = std::vector<std::optional<T>>((anEnd - aBegin + myGrain - 1) / myGrain);
+    detail::forEachChunk(
+        aPool, myResults.size(),
+        [&](std::size_t aChunkIndex)
+        {
+            const auto myBegin = aBegin + aChunkIndex * myGrain;
+            myResults[aChunkIndex].emplace(aMap(myBegin, std::min(myBegin + myGrain, anEnd)));
+        }
+    );
+    auto myResult = std::move(anIdentity);
+    for (auto& myChunkResult : myResults)
+    {
+        myResult = aCombine(std::move(myResult), std::move(*myChunkResult));
+    }
+    return myResult;
+}
+} // namespace polya
@@ -0,0 +1,303 @@
+#include "core/util/Trace.hh"
+
+#include "core/util/Exception.hh"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace polya::trace
+{
+namespace
+{
+struct Event
+{
+    const char* theName;
+    detail::Clock::time_point theStart;
+    detail::Clock::duration theDuration;
+};
+
+// The owning thread appends and the writer reads, so the lock is almost never contended. Storage
+// grows on demand up to the capacity, then the oldest spans are overwritten.
+struct RingBuffer
+{
+    std::mutex theMutex;
+    std::uint64_t theThreadId = 0;
+    std::size_t theCapacity = 0;
+    std::vector<Event> theEvents;
+    std::size_t theNext = 0;      // Slot to overwrite once full
+    bool theThreadExited = false; // Guarded by the registry mutex
+
+    auto reset(std::size_t aCapacity) -> void
+    {
+        theCapacity = aCapacity;
+        theEvents.clear();
+        theNext = 0;
+    }
+
+    auto push(const Event& anEvent) -> void
+    {
+        if (theEvents.size() < theCapacity)
+        {
+            theEvents.push_back(anEvent);
+            return;
+        }
+        if (theCapacity != 0)
+        {
+            theEvents[theNext] = anEvent;
+            theNext = (theNext + 1) % theCapacity;
+        }
+    }
+
+    // Oldest first
+    [[nodiscard]] auto at(std::size_t anIndex) const -> const Event&
+    {
+        return theEvents[(theNext + anIndex) % theEvents.size()];
+    }
+};
+
+struct Registry
+{
+    std::mutex theMutex;
+    std::size_t theCapacity = theDefaultCapacity;
+    std::uint64_t theNextThreadId = 1;
+    // Buffers of live threads, and of exited threads until their spans are written or cleared
+    std::vector<std::shared_ptr<RingBuffer>> theBuffers;
+    std::vector<std::shared_ptr<RingBuffer>> theFreeBuffers; // Reused by new threads
+    detail::Clock::time_point theEpoch = detail::Clock::now();
+};
+
+// Never destroyed, so spans ending during static destruction are still safe to record
+auto registry() -> Registry&
+{
+    static auto* theRegistry = new Registry{};
+    return *theRegistry;
+}
+
+// Moves the buffers of exited threads to the free list. Called with the registry locked once
+// their spans have been written or dropped.
+auto recycleExited(Registry& aRegistry) -> void
+{
+    std::erase_if(
+        aRegistry.theBuffers,
+        [&](const auto& aBuffer)
+        {
+            if (not aBuffer->theThreadExited)
+            {
+                return false;
+            }
+            const auto myBufferLock = std::scoped_lock{aBuffer->theMutex};
+            aBuffer->reset(aRegistry.theCapacity);
+            aRegistry.theFreeBuffers.push_back(aBuffer);
+            return true;
+        }
+    );
+}
+
+// Takes a buffer for the calling thread and hands it back when the thread exits. Its spans stay
+// in the registry until they are written, after which the buffer is reused by another thread.
+class BufferOwner
+{
+public:
+    BufferOwner()
+    {
+        auto& myRegistry = registry();
+        const auto myLock = std::scoped_lock{myRegistry.theMutex};
+        if (myRegistry.theFreeBuffers.empty())
+        {
+            theBuffer = std::make_shared<RingBuffer>();
+        }
+        else
+        {
+            theBuffer = std::move(myRegistry.theFreeBuffers.back());
+            myRegistry.theFreeBuffers.pop_back();
+        }
+        theBuffer->theThreadId = myRegistry.theNextThreadId++;
+        theBuffer->theThreadExited = false;
+        theBuffer->reset(myRegistry.theCapacity);
+        myRegistry.theBuffers.push_back(theBuffer);
+    }
+
+    ~BufferOwner()
+    {
+        auto& myRegistry = registry();
+        const auto myLock = std::scoped_lock{myRegistry.theMutex};
+        theBuffer->theThreadExited = true;
+        const auto myEmpty = [&]
+        {
+            const auto myBufferLock = std::scoped_lock{theBuffer->theMutex};
+            return theBuffer->theEvents.empty();
+        }();
+        if (myEmpty)
+        {
+            std::erase(myRegistry.theBuffers, theBuffer);
+            myRegistry.theFreeBuffers.push_back(std::move(theBuffer));
+        }
+        theBuffer = nullptr;
+    }
+
+    BufferOwner(const BufferOwner&) = delete;
+    auto operator=(const BufferOwner&) -> BufferOwner& = delete;
+
+    [[nodiscard]] auto buffer() const -> RingBuffer*
+    {
+        return theBuffer.get();
+    }
+
+private:
+    std::shared_ptr<RingBuffer> theBuffer;
+};
+
+// Null once the thread's owner has been destroyed, i.e. in later thread_local destructors
+auto threadBuffer() -> RingBuffer*
+{
+    thread_local auto theOwner = BufferOwner{};
+    return theOwner.buffer();
+}
+
+auto microseconds(detail::Clock::duration aDuration) -> double
+{
+    return std::chrono::duration<double, std::micro>{aDuration}.count();
+}
+
+// Names are string literals from this library, so only quotes and backslashes need escaping
+auto writeString(std::ostream& aStream, const char* aString) -> void
+{
+    aStream << '"';
+    for (const auto* myCharacter = aString; *myCharacter != '\0'; ++myCharacter)
+    {
+        if (*myCharacter == '"' or *myCharacter == '\\')
+        {
+            aStream << '\\';
+        }
+        aStream << *myCharacter;
+    }
+    aStream << '"';
+}
+
+auto writeAtExit() -> void
+{
+    const auto myPath = std::string{std::getenv("POLYA_TRACE")};
+    auto myFile = std::ofstream{myPath};
+    write(myFile);
+    if (not myFile.good())
+    {
+        std::cerr << "Could not write trace file " << myPath << '\n'; // Too late to throw
+    }
+}
+
+// Enables tracing for the whole process when POLYA_TRACE names an output file
+[[maybe_unused]] const auto theEnvironmentTrace = []
+{
+    const auto* myPath = std::getenv("POLYA_TRACE");
+    if (myPath == nullptr or *myPath == '\0')
+    {
+        return false;
+    }
+    enable();
+    std::atexit(writeAtExit);
+    return true;
+}();
+} // namespace
+
+auto enable(std::size_t aCapacity) -> void
+{
+    auto& myRegistry = registry();
+    const auto myLock = std::scoped_lock{myRegistry.theMutex};
+    myRegistry.theCapacity = aCapacity;
+    for (const auto& myBuffer : myRegistry.theBuffers)
+    {
+        const auto myBufferLock = std::scoped_lock{myBuffer->theMutex};
+        myBuffer->reset(aCapacity);
+    }
+    recycleExited(myRegistry);
+    detail::theEnabled.store(true, std::memory_order_relaxed);
+}
+
+auto disable() -> void
+{
+    detail::theEnabled.store(false, std::memory_order_relaxed);
+}
+
+auto clear() -> void
+{
+    auto& myRegistry = registry();
+    const auto myLock = std::scoped_lock{myRegistry.theMutex};
+    for (const auto& myBuffer : myRegistry.theBuffers)
+    {
+        const auto myBufferLock = std::scoped_lock{myBuffer->theMutex};
+        myBuffer->reset(myRegistry.theCapacity);
+    }
+    recycleExited(myRegistry);
+}
+
+auto spanCount() -> std::size_t
+{
+    auto& myRegistry = registry();
+    const auto myLock = std::scoped_lock{myRegistry.theMutex};
+    auto myCount = 0uz;
+    for (const auto& myBuffer : myRegistry.theBuffers)
+    {
+        const auto myBufferLock = std::scoped_lock{myBuffer->theMutex};
+        myCount += myBuffer->theEvents.size();
+    }
+    return myCount;
+}
+
+auto write(std::ostream& aStream) -> void
+{
+    auto& myRegistry = registry();
+    const auto myLock = std::scoped_lock{myRegistry.theMutex};
+    aStream << "{\"traceEvents\":[";
+    auto myFirst = true;
+    for (const auto& myBuffer : myRegistry.theBuffers)
+    {
+        const auto myBufferLock = std::scoped_lock{myBuffer->theMutex};
+        for (auto myIndex = 0uz; myIndex < myBuffer->theEvents.size(); ++myIndex)
+        {
+            const auto& myEvent = myBuffer->at(myIndex);
+            aStream << (myFirst ? "\n" : ",\n") << "{\"name\":";
+            writeString(aStream, myEvent.theName);
+            aStream << ",\"cat\":\"polya\",\"ph\":\"X\",\"ts\":"
+                    << microseconds(myEvent.theStart - myRegistry.theEpoch)
+                    << ",\"dur\":" << microseconds(myEvent.theDuration)
+                    << ",\"pid\":1,\"tid\":" << myBuffer->theThreadId << '}';
+            myFirst = false;
+        }
+    }
+    aStream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    recycleExited(myRegistry);
+}
+
+auto bufferCount() -> std::size_t
+{
+    auto& myRegistry = registry();
+    const auto myLock = std::scoped_lock{myRegistry.theMutex};
+    return myRegistry.theBuffers.size();
+}
+
+auto write(const std::string& aPath) -> void
+{
+    auto myFile = std::ofstream{aPath};
+    ensure(myFile.good(), "Could not open trace file {}", aPath);
+    write(myFile);
+    ensure(myFile.good(), "Could not write trace file {}", aPath);
+}
+
+namespace detail
+{
+auto record(const char* aName, Clock::time_point aStart, Clock::time_point anEnd) -> void
+{
+    auto* myBuffer = threadBuffer();
+    if (myBuffer == nullptr)
+    {
+        return;
+    }
+    const auto myLock = std::scoped_lock{myBuffer->theMutex};
+    myBuffer->push(Event{aName, aStart, anEnd - aStart});
+}
+} // namespace detail
+} // namespace polya::trace
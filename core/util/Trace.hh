@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+// Scoped trace spans written as Chrome/Perfetto JSON (load the file in ui.perfetto.dev or
+// chrome://tracing). Each thread records into its own ring buffer, which keeps only the most
+// recent spans, so tracing can stay on for long runs. Enable with trace::enable(), or by setting
+// POLYA_TRACE=<file> to trace the whole process and write the file at exit.
+namespace polya::trace
+{
+inline constexpr auto theDefaultCapacity = 1uz << 16; // Spans kept per thread
+
+auto enable(std::size_t aCapacity = theDefaultCapacity) -> void; // Clears recorded spans
+auto disable() -> void;
+auto clear() -> void;
+
+[[nodiscard]] auto spanCount() -> std::size_t; // Spans currently held, over all threads
+// Buffers of live threads and of exited threads whose spans have not been written yet
+[[nodiscard]] auto bufferCount() -> std::size_t;
+
+// Spans of threads that have exited are written once, then their buffers are reused
+auto write(std::ostream& aStream) -> void;
+auto write(const std::string& aPath) -> void; // Throws if the file cannot be written
+
+namespace detail
+{
+inline auto theEnabled = std::atomic<bool>{false};
+
+using Clock = std::chrono::steady_clock;
+
+auto record(const char* aName, Clock::time_point aStart, Clock::time_point anEnd) -> void;
+} // namespace detail
+
+[[nodiscard]] inline auto isEnabled() -> bool
+{
+    return detail::theEnabled.load(std::memory_order_relaxed);
+}
+
+// Records the wall time of its scope. The name must outlive the trace, e.g. a string literal.
+class Span
+{
+public:
+    explicit Span(const char* aName)
+        : theName{isEnabled() ? aName : nullptr},
+          theStart{theName != nullptr ? detail::Clock::now() : detail::Clock::time_point{}}
+    {
+    }
+
+    ~Span()
+    {
+        if (theName != nullptr)
+        {
+            detail::record(theName, theStart, detail::Clock::now());
+        }
+    }
+
+    Span(const Span&) = delete;
+    auto operator=(const Span&) -> Span& = delete;
+
+private:
+    const char* theName; // Null when tracing was off at construction
+    detail::Clock::time_point theStart;
+};
+} // namespace polya::trace
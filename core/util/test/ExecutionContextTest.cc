@@ -0,0 +1,73 @@
+#include "core/util/ExecutionContext.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace polya::test
+{
+using namespace ::testing;
+using Phase = stats::Phase;
+using Progress = ExecutionContext::Progress;
+
+class ExecutionContextTest : public ::testing::Test
+{
+};
+
+TEST_F(ExecutionContextTest, UnlimitedNeverStops)
+{
+    EXPECT_NO_THROW(ExecutionContext::unlimited().checkpoint(Phase::CycleIndex, 1, 2));
+}
+
+TEST_F(ExecutionContextTest, StopRequested)
+{
+    auto mySource = std::stop_source{};
+    const auto myContext = ExecutionContext{mySource.get_token()};
+    EXPECT_NO_THROW(myContext.checkpoint(Phase::CycleIndex, 0));
+
+    mySource.request_stop();
+    try
+    {
+        myContext.checkpoint(Phase::CycleIndex, 0);
+        FAIL() << "Expected Interrupted";
+    }
+    catch (const Interrupted& anError)
+    {
+        EXPECT_THAT(anError.reason(), Eq(Interrupted::Reason::Cancelled));
+        EXPECT_THAT(anError.phase(), Eq(Phase::CycleIndex));
+        EXPECT_THAT(anError.what(), StrEq("Cancelled during cycle index"));
+    }
+}
+
+TEST_F(ExecutionContextTest, DeadlinePassed)
+{
+    const auto myContext = ExecutionContext{
+        std::stop_token{}, ExecutionContext::Clock::now() - std::chrono::seconds{1}};
+    try
+    {
+        myContext.checkpoint(Phase::ColourEvaluation, 0);
+        FAIL() << "Expected Interrupted";
+    }
+    catch (const Interrupted& anError)
+    {
+        EXPECT_THAT(anError.reason(), Eq(Interrupted::Reason::DeadlineExceeded));
+    }
+}
+
+TEST_F(ExecutionContextTest, ReportsProgress)
+{
+    auto myReports = std::vector<std::size_t>{};
+    const auto myContext = ExecutionContext{
+        std::stop_token{}, std::nullopt,
+        [&myReports](const Progress& aProgress)
+        {
+            EXPECT_THAT(aProgress.thePhase, Eq(Phase::GroupGeneration));
+            EXPECT_THAT(aProgress.theTotal, Eq(10u));
+            myReports.push_back(aProgress.theProcessed);
+        }};
+    myContext.checkpoint(Phase::GroupGeneration, 3, 10);
+    myContext.checkpoint(Phase::GroupGeneration, 7, 10);
+    EXPECT_THAT(myReports, ElementsAre(3u, 7u));
+}
+} // namespace polya::test
@@ -0,0 +1,63 @@
+#include "core/util/Stats.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <thread>
+
+namespace polya::test
+{
+using namespace ::testing;
+using stats::Counter;
+using stats::Phase;
+
+class StatsTest : public ::testing::Test
+{
+};
+
+TEST_F(StatsTest, CountsAccumulate)
+{
+#ifdef POLYA_NO_STATS
+    GTEST_SKIP() << "Statistics are compiled out";
+#endif
+    const auto myBefore = stats::snapshot();
+    stats::count(Counter::GcdCalls);
+    stats::count(Counter::GcdCalls, 4);
+    const auto myDelta = stats::snapshot() - myBefore;
+    EXPECT_THAT(myDelta.count(Counter::GcdCalls), Eq(5u));
+    EXPECT_THAT(myDelta.count(Counter::PermutationProducts), Eq(0u));
+}
+
+TEST_F(StatsTest, CountsOfExitedThreadsAreKept)
+{
+#ifdef POLYA_NO_STATS
+    GTEST_SKIP() << "Statistics are compiled out";
+#endif
+    const auto myBefore = stats::snapshot();
+    std::thread{[] { stats::count(Counter::MapInsertions, 3); }}.join();
+    std::thread{[] { stats::count(Counter::MapInsertions, 2); }}.join();
+    const auto myDelta = stats::snapshot() - myBefore;
+    EXPECT_THAT(myDelta.count(Counter::MapInsertions), Eq(5u));
+}
+
+TEST_F(StatsTest, ScopedTimerCountsCalls)
+{
+#ifdef POLYA_NO_STATS
+    GTEST_SKIP() << "Statistics are compiled out";
+#endif
+    const auto myBefore = stats::snapshot();
+    {
+        const auto myTimer = stats::ScopedTimer{Phase::CycleIndex};
+    }
+    const auto myDelta = stats::snapshot() - myBefore;
+    EXPECT_THAT(myDelta.calls(Phase::CycleIndex), Eq(1u));
+    EXPECT_THAT(myDelta.calls(Phase::GroupGeneration), Eq(0u));
+}
+
+TEST_F(StatsTest, ToStringNamesEveryCounter)
+{
+    const auto myString = stats::snapshot().toString();
+    EXPECT_THAT(myString, HasSubstr("permutation products: "));
+    EXPECT_THAT(myString, HasSubstr("polynomial multiplication: "));
+}
+} // namespace polya::test
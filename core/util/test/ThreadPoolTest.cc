@@ -0,0 +1,193 @@
+#include "core/util/ThreadPool.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <latch>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace polya::test
+{
+using namespace ::testing;
+
+class ThreadPoolTest : public ::testing::Test
+{
+};
+
+TEST_F(ThreadPoolTest, RunsEveryTask)
+{
+    auto myCount = std::atomic<int>{0};
+    {
+        auto myPool = ThreadPool{4, 8};
+        for (auto myIndex = 0; myIndex < 1000; ++myIndex)
+        {
+            myPool.submit([&myCount] { myCount.fetch_add(1); });
+        }
+    }
+    EXPECT_THAT(myCount.load(), Eq(1000));
+}
+
+TEST_F(ThreadPoolTest, QueueIsBounded)
+{
+    auto myPool = ThreadPool{1, 2};
+    auto myRelease = std::promise<void>{};
+    auto myStarted = std::latch{1};
+    myPool.submit(
+        [&myStarted, myReleased = myRelease.get_future().share()]
+        {
+            myStarted.count_down();
+            myReleased.wait();
+        }
+    );
+    myStarted.wait();
+    myPool.submit([] {});
+    myPool.submit([] {});
+    EXPECT_THAT(myPool.queued(), Eq(2u));
+
+    auto mySubmitted = std::async(std::launch::async, [&myPool] { myPool.submit([] {}); });
+    EXPECT_THAT(
+        mySubmitted.wait_for(std::chrono::milliseconds{50}), Eq(std::future_status::timeout)
+    );
+    myRelease.set_value();
+    mySubmitted.wait();
+}
+
+TEST_F(ThreadPoolTest, WorkerSubmissionsDoNotBlockOnFullQueue)
+{
+    auto myCount = std::atomic<int>{0};
+    auto myDone = std::promise<void>{};
+    {
+        auto myPool = ThreadPool{1, 1};
+        myPool.submit(
+            [&]
+            {
+                for (auto myIndex = 0; myIndex < 10; ++myIndex)
+                {
+                    myPool.submit([&myCount] { myCount.fetch_add(1); });
+                }
+                myDone.set_value();
+            }
+        );
+        myDone.get_future().wait();
+    }
+    EXPECT_THAT(myCount.load(), Eq(10));
+}
+
+TEST_F(ThreadPoolTest, QueuedNeverExceedsTasksSubmittedWhileStealing)
+{
+    // Tasks pushed by workers are stolen straight away, which must not take the count below zero.
+    // The window is short, so the race is repeated.
+    constexpr auto myTaskCount = 10000;
+    for (auto myRound = 0; myRound < 20; ++myRound)
+    {
+        auto myCount = std::atomic<int>{0};
+        auto myMaximum = 0uz;
+        {
+            auto myPool = ThreadPool{4, 8};
+            auto mySubmitted = std::latch{1};
+            myPool.submit(
+                [&]
+                {
+                    for (auto myIndex = 0; myIndex < myTaskCount; ++myIndex)
+                    {
+                        myPool.submit([&myCount] { myCount.fetch_add(1); });
+                    }
+                    mySubmitted.count_down();
+                }
+            );
+            while (not mySubmitted.try_wait())
+            {
+                myMaximum = std::max(myMaximum, myPool.queued());
+            }
+        }
+        ASSERT_THAT(myMaximum, Le(static_cast<std::size_t>(myTaskCount)));
+        ASSERT_THAT(myCount.load(), Eq(myTaskCount));
+    }
+}
+
+TEST_F(ThreadPoolTest, ParallelForCoversRangeOnce)
+{
+    auto myPool = ThreadPool{4, 8};
+    auto myHits = std::vector<std::atomic<int>>(1000);
+    parallelFor(
+        5, 1000, 7,
+        [&myHits](std::size_t aBegin, std::size_t anEnd)
+        {
+            for (auto myIndex = aBegin; myIndex < anEnd; ++myIndex)
+            {
+                myHits[myIndex].fetch_add(1);
+            }
+        },
+        myPool
+    );
+    for (auto myIndex = 0uz; myIndex < myHits.size(); ++myIndex)
+    {
+        EXPECT_THAT(myHits[myIndex].load(), Eq(myIndex < 5 ? 0 : 1));
+    }
+}
+
+TEST_F(ThreadPoolTest, ParallelReduceCombinesInChunkOrder)
+{
+    auto myPool = ThreadPool{4, 8};
+    const auto myResult = parallelReduce(
+        0uz, 100uz, 3uz, std::vector<std::size_t>{},
+        [](std::size_t aBegin, std::size_t anEnd)
+        {
+            auto myValues = std::vector<std::size_t>(anEnd - aBegin);
+            std::iota(myValues.begin(), myValues.end(), aBegin);
+            return myValues;
+        },
+        [](std::vector<std::size_t>&& aResult, std::vector<std::size_t>&& aValues)
+        {
+            aResult.insert(aResult.end(), aValues.begin(), aValues.end());
+            return std::move(aResult);
+        },
+        myPool
+    );
+    auto myExpected = std::vector<std::size_t>(100);
+    std::iota(myExpected.begin(), myExpected.end(), 0uz);
+    EXPECT_THAT(myResult, Eq(myExpected));
+}
+
+TEST_F(ThreadPoolTest, NestedParallelForOnOneWorker)
+{
+    auto myPool = ThreadPool{1, 1};
+    auto myCount = std::atomic<int>{0};
+    parallelFor(
+        0, 8, 1,
+        [&](std::size_t, std::size_t)
+        {
+            parallelFor(
+                0, 8, 1, [&](std::size_t, std::size_t) { myCount.fetch_add(1); }, myPool
+            );
+        },
+        myPool
+    );
+    EXPECT_THAT(myCount.load(), Eq(64));
+}
+
+TEST_F(ThreadPoolTest, ParallelForRethrows)
+{
+    auto myPool = ThreadPool{2, 8};
+    EXPECT_THROW(
+        parallelFor(
+            0, 100, 1,
+            [](std::size_t aBegin, std::size_t)
+            {
+                if (aBegin == 42)
+                {
+                    throw std::runtime_error{"chunk failed"};
+                }
+            },
+            myPool
+        ),
+        std::runtime_error
+    );
+}
+} // namespace polya::test
@@ -0,0 +1,109 @@
+#include "core/util/Trace.hh"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
+namespace polya::test
+{
+using namespace ::testing;
+
+class TraceTest : public ::testing::Test
+{
+};
+
+TEST_F(TraceTest, DisabledRecordsNothing)
+{
+    trace::enable();
+    trace::disable();
+    {
+        const auto mySpan = trace::Span{"span"};
+    }
+    EXPECT_THAT(trace::spanCount(), Eq(0u));
+}
+
+TEST_F(TraceTest, EnabledRecordsSpans)
+{
+    trace::enable();
+    {
+        const auto myOuter = trace::Span{"outer"};
+        const auto myInner = trace::Span{"inner"};
+    }
+    std::thread{[] { const auto mySpan = trace::Span{"worker"}; }}.join();
+    trace::disable();
+    EXPECT_THAT(trace::spanCount(), Eq(3u));
+}
+
+TEST_F(TraceTest, RingBufferKeepsMostRecentSpans)
+{
+    trace::enable(2);
+    for (const auto* myName : {"first", "second", "third"})
+    {
+        const auto mySpan = trace::Span{myName};
+    }
+    trace::disable();
+    EXPECT_THAT(trace::spanCount(), Eq(2u));
+
+    auto myStream = std::ostringstream{};
+    trace::write(myStream);
+    EXPECT_THAT(myStream.str(), Not(HasSubstr("\"first\"")));
+    EXPECT_THAT(myStream.str(), HasSubstr("\"third\""));
+}
+
+TEST_F(TraceTest, WritesChromeTraceEvents)
+{
+    trace::enable();
+    {
+        const auto mySpan = trace::Span{"cycle index"};
+    }
+    trace::disable();
+    auto myStream = std::ostringstream{};
+    trace::write(myStream);
+    EXPECT_THAT(myStream.str(), StartsWith("{\"traceEvents\":["));
+    EXPECT_THAT(
+        myStream.str(), HasSubstr("{\"name\":\"cycle index\",\"cat\":\"polya\",\"ph\":\"X\"")
+    );
+}
+
+TEST_F(TraceTest, ClearDropsSpans)
+{
+    trace::enable();
+    {
+        const auto mySpan = trace::Span{"span"};
+    }
+    trace::clear();
+    trace::disable();
+    EXPECT_THAT(trace::spanCount(), Eq(0u));
+}
+
+TEST_F(TraceTest, ReusesBuffersOfExitedThreads)
+{
+    trace::enable();
+    const auto myBuffers = trace::bufferCount();
+    for (auto myThread = 0; myThread < 8; ++myThread)
+    {
+        std::thread{[] { const auto mySpan = trace::Span{"worker"}; }}.join();
+        EXPECT_THAT(trace::bufferCount(), Eq(myBuffers + 1));
+
+        // The spans of an exited thread are written once, then its buffer is free again
+        auto myStream = std::ostringstream{};
+        trace::write(myStream);
+        EXPECT_THAT(myStream.str(), HasSubstr("\"worker\""));
+        EXPECT_THAT(trace::bufferCount(), Eq(myBuffers));
+    }
+
+    // Threads without spans left hand their buffers back straight away
+    std::thread{[]
+                {
+                    {
+                        const auto mySpan = trace::Span{"cleared"};
+                    }
+                    trace::clear();
+                }}
+        .join();
+    EXPECT_THAT(trace::bufferCount(), Eq(myBuffers));
+    trace::disable();
+}
+} // namespace polya::test